@@ -0,0 +1,156 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_BENCH_HARNESS_H
+#define LIBMESH_BENCH_HARNESS_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/parallel.h"
+
+// C++ includes
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+namespace Bench
+{
+
+/**
+ * Timings for one benchmark case.  Each entry of \p times is the
+ * wall clock time, in seconds, of one repetition on the slowest
+ * processor.
+ */
+struct Result
+{
+  std::string name;
+  std::vector<double> times;
+
+  double min() const;
+  double median() const;
+  double mean() const;
+  double max() const;
+};
+
+
+
+/**
+ * The state passed to each registered benchmark function.  A
+ * benchmark builds whatever data it needs and then calls time() for
+ * each case it wants measured.
+ */
+class State
+{
+public:
+  /**
+   * Constructor.  Each case is run \p n_reps times after one untimed
+   * warmup run.  \p size is the base problem size (typically elements
+   * per side of a generated mesh).  Only cases whose names contain
+   * \p filter are run.  If \p list_only is true, case names are
+   * recorded but nothing is run.
+   */
+  State (const Parallel::Communicator & comm,
+         unsigned int n_reps,
+         unsigned int size,
+         std::string filter,
+         bool list_only);
+
+  const Parallel::Communicator & comm () const { return _comm; }
+
+  /**
+   * \returns The base problem size benchmarks should scale with.
+   */
+  unsigned int size () const { return _size; }
+
+  /**
+   * \returns Whether the case \p name should be run.  Benchmarks
+   * should check this before doing any setup for a case, and only
+   * call time() for cases that are wanted.
+   */
+  bool wants (const std::string & name);
+
+  /**
+   * Times \p body.  \p setup is called, untimed, before every call to
+   * \p body, so that \p body can consume or modify its inputs.
+   * All processors are synchronized before each timed call.
+   */
+  void time (const std::string & name,
+             const std::function<void()> & setup,
+             const std::function<void()> & body);
+
+  /**
+   * Times \p body, with no per-repetition setup.
+   */
+  void time (const std::string & name,
+             const std::function<void()> & body);
+
+  /**
+   * \returns The names of the cases which wants() was asked about and
+   * which matched the filter.
+   */
+  const std::vector<std::string> & case_names () const { return _case_names; }
+
+  const std::vector<Result> & results () const { return _results; }
+
+private:
+  const Parallel::Communicator & _comm;
+  const unsigned int _n_reps;
+  const unsigned int _size;
+  const std::string _filter;
+  const bool _list_only;
+
+  std::vector<std::string> _case_names;
+  std::vector<Result> _results;
+};
+
+
+
+typedef void (*Function) (State &);
+
+/**
+ * \returns All benchmark functions registered with
+ * LIBMESH_BENCHMARK, in registration order, with their names.
+ */
+std::vector<std::pair<std::string, Function>> & registry ();
+
+/**
+ * Helper whose construction adds a benchmark function to the
+ * registry.
+ */
+struct Registration
+{
+  Registration (const char * name, Function f)
+  { registry().emplace_back(name, f); }
+};
+
+} // namespace Bench
+} // namespace libMesh
+
+/**
+ * Registers \p function, a void(Bench::State &), to be run by the
+ * benchmark driver under the group name \p name.
+ */
+#define LIBMESH_BENCHMARK(name, function)                               \
+  static const libMesh::Bench::Registration                             \
+  libmesh_bench_registration_##function (name, function)
+
+#endif // LIBMESH_BENCH_HARNESS_H
@@ -32,6 +32,7 @@
 #include "libmesh/sparsity_pattern.h"
 #include "libmesh/parallel_object.h"
 #include "libmesh/point.h"
+#include "libmesh/simple_range.h"
 #include "libmesh/utility.h"
 
 // C++ Includes
@@ -40,6 +41,7 @@
 #include <iterator>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 #include <memory>
 
@@ -235,6 +237,27 @@ public:
    */
   std::size_t distribute_dofs (MeshBase &);
 
+  /**
+   * Sets whether distribute_dofs() visits the active local elements
+   * in reverse Cuthill-McKee order of their face neighbor graph when
+   * numbering local dofs, rather than in mesh iteration order.  On
+   * meshes with an arbitrary element ordering, e.g. many read from
+   * file, this keeps coupled dofs close together, which narrows the
+   * local matrix bandwidth and improves the locality of matrix and
+   * vector kernels.
+   *
+   * Takes effect at the next distribute_dofs().
+   */
+  void set_bandwidth_reducing_numbering(bool reduce)
+  { _bandwidth_reducing_numbering = reduce; }
+
+  /**
+   * Returns true iff distribute_dofs() numbers local dofs in a
+   * bandwidth reducing element order.
+   */
+  bool bandwidth_reducing_numbering() const
+  { return _bandwidth_reducing_numbering; }
+
   /**
    * Computes the sparsity pattern for the matrices corresponding to
    * \p proc_id and sends that data to Linear Algebra packages for
@@ -247,6 +270,12 @@ public:
    */
   bool computed_sparsity_already () const;
 
+  /**
+   * Returns true iff a sparsity pattern has been computed since dofs
+   * were last distributed, so that it describes the current numbering.
+   */
+  bool sparsity_is_current () const;
+
   /**
    * Sets the current policy for constructing sparsity patterns: if
    * \p use_constraints is true (for robustness), we explicitly
@@ -266,6 +295,94 @@ public:
    */
   bool constrained_sparsity_construction();
 
+  /**
+   * Sets whether a full sparsity pattern, when one is needed, is kept
+   * in compressed (CSR) storage rather than as one vector per row.
+   * Compressed storage avoids the per-row allocation overhead and
+   * slack, which dominates the memory use of large sparsity patterns.
+   * This is false by default, because with it set
+   * get_sparsity_pattern()->get_sparsity_pattern() is empty and
+   * callers must use get_compressed_sparsity_pattern() instead.
+   */
+  void set_compressed_sparsity_storage(bool use_compressed)
+  { _compressed_sparsity_storage = use_compressed; }
+
+  /**
+   * Returns true iff full sparsity patterns are kept in compressed
+   * storage.
+   */
+  bool compressed_sparsity_storage() const
+  { return _compressed_sparsity_storage; }
+
+  /**
+   * Sets whether, when no attached matrix needs the full sparsity
+   * pattern, compute_sparsity() computes exact per-row n_nz and n_oz
+   * counts.  By default the counts are only upper bounds, built
+   * cheaply from each thread's chunk of elements; exact counts avoid
+   * over-allocating matrix storage, and only hold the rows currently
+   * being assembled rather than the whole pattern, at the cost of an
+   * extra, unthreaded, pass over the elements.
+   */
+  void set_exact_sparsity_counts(bool use_exact)
+  { _exact_sparsity_counts = use_exact; }
+
+  /**
+   * Returns true iff compute_sparsity() computes exact nonzero counts
+   * when it doesn't need the full sparsity pattern.
+   */
+  bool exact_sparsity_counts() const
+  { return _exact_sparsity_counts; }
+
+  /**
+   * Sets whether compute_sparsity() may update the nonzero counts it
+   * computed last time, instead of recomputing them on every element,
+   * after adaptive refinement.  Only rows touched by refined or
+   * coarsened elements, their point neighbors, or constraints are
+   * recomputed; other rows reuse their previous counts, found through
+   * the old dof objects.
+   *
+   * Updates only happen when they are known to be safe: when the
+   * full sparsity pattern isn't needed, the mesh hasn't been
+   * repartitioned (it is serial, or skip_partitioning() is set),
+   * distribute_dofs() has been called exactly once since the last
+   * compute_sparsity(), no extra sparsity functions or objects or
+   * coupling functors beyond the default are in use, and the default
+   * coupling adds no neighbor layers.  Otherwise compute_sparsity()
+   * silently does a full rebuild.
+   */
+  void set_incremental_sparsity(bool use_incremental)
+  { _incremental_sparsity = use_incremental; }
+
+  /**
+   * Returns true iff compute_sparsity() may update nonzero counts
+   * incrementally.
+   */
+  bool incremental_sparsity() const
+  { return _incremental_sparsity; }
+
+  /**
+   * Sets the DofMaps whose sparsity patterns compute_sparsity() may
+   * copy instead of building its own; the first suitable one is used.
+   * \p sources must outlive any compute_sparsity() call made while
+   * they are set; pass an empty vector to clear them.
+   *
+   * A pattern is only copied when the two maps are known to produce
+   * the same one: both must be on the same mesh, with the same
+   * variable group types and subdomains, dof coupling, dof
+   * partitioning, and sparsity and numbering options, with no
+   * coupling functors beyond the default (adding the same neighbor
+   * layers), no periodic boundaries, extra sparsity functions or
+   * objects, or constrained sparsity construction, and the source must
+   * have computed its sparsity since it last distributed its dofs.
+   * Otherwise compute_sparsity() silently builds the pattern itself.
+   *
+   * EquationSystems sets this while it initializes or reinitializes
+   * its systems, so that systems with identical layouts share the
+   * sparsity computation.
+   */
+  void set_sparsity_sources(std::vector<const DofMap *> sources)
+  { _sparsity_sources = std::move(sources); }
+
   /**
    * Clears the sparsity pattern
    */
@@ -779,6 +896,46 @@ public:
                     std::vector<dof_id_type> & di,
                     const unsigned int vn) const;
 
+  /**
+   * Sets whether distribute_dofs() caches the global degree of
+   * freedom indices of every active local element, for each
+   * variable, in flat storage.  dof_indices() queries for cached
+   * elements at their own p refinement level are then answered by a
+   * copy, without walking the element's nodes, and
+   * cached_dof_indices() returns them with no copy at all.
+   *
+   * The cache is rebuilt by each distribute_dofs() and so, like the
+   * indices stored on the mesh itself, is invalidated by any mesh
+   * change until the next reinit.  Disabling caching frees it.
+   */
+  void set_dof_indices_caching(bool cache);
+
+  /**
+   * Returns true iff distribute_dofs() caches element dof indices.
+   */
+  bool dof_indices_caching() const
+  { return _dof_indices_caching; }
+
+  /**
+   * Returns true iff the dof indices of \p elem are cached.
+   */
+  bool has_cached_dof_indices(const Elem & elem) const;
+
+  /**
+   * Returns the cached global degree of freedom indices of \p elem for
+   * all variables, in the same order dof_indices() would give them.
+   * The element must have cached indices; see
+   * has_cached_dof_indices().
+   */
+  SimpleRange<const dof_id_type *> cached_dof_indices(const Elem & elem) const;
+
+  /**
+   * Returns the cached global degree of freedom indices of \p elem for
+   * variable \p vn.
+   */
+  SimpleRange<const dof_id_type *> cached_dof_indices(const Elem & elem,
+                                                      const unsigned int vn) const;
+
 #ifdef LIBMESH_ENABLE_AMR
 
   /**
@@ -854,6 +1011,16 @@ public:
    */
   void set_verify_dirichlet_bc_consistency(bool val);
 
+  /**
+   * Keep what \p update_dirichlet_constraint_values() needs: the
+   * constraints as they stood before \p process_constraints(), which
+   * dofs took their values from the Dirichlet boundaries, and which
+   * local elements have Dirichlet boundaries.  Takes effect at the
+   * next \p create_dof_constraints().  Off by default, since it
+   * doubles the storage for constraints.
+   */
+  void set_dirichlet_value_updates(bool val);
+
   /**
    * Tells other library functions whether or not this problem
    * includes coupling between dofs in neighboring cells, as can
@@ -952,6 +1119,23 @@ public:
    */
   void process_constraints (MeshBase &);
 
+  /**
+   * Re-evaluates the heterogeneous values of the primal Dirichlet
+   * constraints at time \p time, then reprocesses the constraints,
+   * leaving the constraint rows (hanging node, periodic, user and
+   * Dirichlet) as they were built.  The projection is only redone on
+   * the local elements with Dirichlet boundaries, threaded over them.
+   *
+   * This is correct when only the Dirichlet boundary values depend on
+   * time; if anything else has changed, the constraints should be
+   * rebuilt by \p create_dof_constraints() instead.  Requires
+   * \p set_dirichlet_value_updates() to have been enabled when the
+   * constraints were built.  Adjoint constraint values are not
+   * updated.  As after \p process_constraints(), the send list needs
+   * to be prepared again.
+   */
+  void update_dirichlet_constraint_values (MeshBase & mesh, Real time);
+
   /**
    * Throw an error if we detect any constraint loops, i.e.
    * A -> B -> C -> A
@@ -1025,12 +1209,14 @@ public:
   void stash_dof_constraints()
   {
     libmesh_assert(_stashed_dof_constraints.empty());
+    this->invalidate_constrained_dof_lookup();
     _dof_constraints.swap(_stashed_dof_constraints);
   }
 
   void unstash_dof_constraints()
   {
     libmesh_assert(_dof_constraints.empty());
+    this->invalidate_constrained_dof_lookup();
     _dof_constraints.swap(_stashed_dof_constraints);
   }
 
@@ -1048,6 +1234,7 @@ public:
    */
   void swap_dof_constraints()
   {
+    this->invalidate_constrained_dof_lookup();
     _dof_constraints.swap(_stashed_dof_constraints);
   }
 
@@ -1573,6 +1760,48 @@ public:
    */
   std::string get_info() const;
 
+  /**
+   * \returns Estimates of the memory, in bytes, used on this processor
+   * by constraints, the send_list, the sparsity pattern and cached
+   * indexing data.
+   */
+  std::vector<std::pair<std::string, std::size_t>> local_memory_usage () const;
+
+  /**
+   * \returns Diagnostics of this processor's share of the degrees of
+   * freedom, for tuning partition sizes: the local and ghost (send
+   * list) dof counts and their ratio, the local constraint counts,
+   * and, if the sparsity pattern is still available, the mean and
+   * maximum number of nonzeros per local row and the fraction of
+   * them in off-processor columns.
+   */
+  std::vector<std::pair<std::string, double>> local_diagnostics () const;
+
+  /**
+   * \returns A histogram of the number of nonzeros (on- plus
+   * off-processor) in each local row of the sparsity pattern: entry
+   * \p i counts the rows with between \f$ 2^i \f$ and
+   * \f$ 2^{i+1}-1 \f$ nonzeros, with empty rows counted in entry 0.
+   * Empty if the sparsity pattern isn't available.
+   */
+  std::vector<dof_id_type> local_nonzeros_histogram () const;
+
+  /**
+   * \returns A table of the local_diagnostics() with their minimum,
+   * maximum and mean per processor, followed by the nonzeros per row
+   * histogram summed over all processors.  This must be called on
+   * all processors at once.
+   */
+  std::string get_diagnostics_info () const;
+
+  /**
+   * \returns The local_nonzeros_histogram() summed over all
+   * processors, as a table, or an empty string if the sparsity
+   * pattern isn't available.  This must be called on all processors
+   * at once.
+   */
+  std::string get_nonzeros_histogram_info () const;
+
   /**
    * Degree of freedom coupling.  If left empty each DOF
    * couples to all others.  Can be used to reduce memory
@@ -1610,6 +1839,30 @@ public:
   std::unique_ptr<SparsityPattern::Build> build_sparsity(const MeshBase & mesh,
                                                          bool calculate_constrained = false) const;
 
+  /**
+   * \returns \p true if build_sparsity() can update the counts saved
+   * by the last compute_sparsity() rather than starting over.  See
+   * set_incremental_sparsity().
+   */
+  bool can_update_sparsity_incrementally(const MeshBase & mesh,
+                                         bool implicit_neighbor_dofs) const;
+
+  /**
+   * \returns \p true if compute_sparsity() can copy the sparsity
+   * pattern of \p other rather than building its own.  See
+   * set_sparsity_sources().
+   */
+  bool can_copy_sparsity_from(const DofMap & other,
+                              const MeshBase & mesh) const;
+
+  /**
+   * Fills in the counts of \p sp by reusing the counts saved by the
+   * last compute_sparsity() for unchanged rows, and computing only
+   * the rows an adaptive refinement step may have changed.
+   */
+  void update_sparsity_incrementally(const MeshBase & mesh,
+                                     SparsityPattern::Build & sp) const;
+
   /**
    * Describe whether the given variable group should be p-refined. If this API is not called with
    * \p false, the default is to p-refine
@@ -1668,6 +1921,18 @@ private:
                           std::vector<dof_id_type> & di,
                           const unsigned int vn) const;
 
+  /**
+   * Fills the dof indices cache for the active local elements of
+   * \p mesh.
+   */
+  void build_dof_indices_cache(const MeshBase & mesh);
+
+  /**
+   * \returns The dof indices cache slot of \p elem, or
+   * DofObject::invalid_id if \p elem isn't cached.
+   */
+  dof_id_type dof_indices_cache_slot(const Elem & elem) const;
+
   /**
    * Invalidates all active DofObject dofs for this system
    */
@@ -1735,6 +2000,29 @@ private:
   void assert_no_nodes_missed(MeshBase & mesh);
 #endif
 
+  /**
+   * Threaded implementation of distribute_local_dofs_var_major() and
+   * distribute_local_dofs_node_major(), used when running with
+   * more than one thread.  Each node's dofs are numbered by the first
+   * element, in iteration order, that would number them serially, so
+   * the result is identical to the serial numbering.
+   */
+  void distribute_local_dofs_threaded (dof_id_type & next_free_dof,
+                                       MeshBase & mesh,
+                                       const bool node_major);
+
+  /**
+   * Computes the reverse Cuthill-McKee ordering of the active local
+   * elements of \p mesh, for bandwidth reducing dof numbering.
+   */
+  void compute_renumbered_elems (MeshBase & mesh);
+
+  /**
+   * \returns The active local elements of \p mesh, in the order
+   * their dofs are numbered.
+   */
+  std::vector<Elem *> local_numbering_order (MeshBase & mesh) const;
+
   /*
    * A utility method for obtaining a set of elements to ghost along
    * with merged coupling matrices.
@@ -1811,6 +2099,41 @@ private:
    */
   void add_constraints_to_send_list();
 
+  /**
+   * Builds the flat tables \p is_constrained_dof() uses in place of a
+   * search of \p _dof_constraints, which is worth doing once the set
+   * of constrained dofs is final.
+   */
+  void build_constrained_dof_lookup();
+
+  /**
+   * Discards the \p is_constrained_dof() lookup tables, so that
+   * queries fall back on \p _dof_constraints.  Must be called before
+   * any change to the set of constrained dofs.
+   */
+  void invalidate_constrained_dof_lookup();
+
+  /**
+   * Substitutes the constraint rows of constrained dofs wherever
+   * those dofs constrain others, updating right hand sides to match,
+   * so that every constraint row we know about is expressed in terms
+   * of dofs we don't know to be constrained.  Each row is resolved
+   * once, after the rows it depends on, via a depth first traversal
+   * of the constraint graph.  Constraint loops are left intact for
+   * check_for_constraint_loops() to find.
+   */
+  void resolve_constraint_chains();
+
+  /**
+   * Sets each of our constrained dofs in \p v to the value its
+   * constraint row gives it, plus its entry in \p rhs if \p rhs is
+   * not null, evaluating the rows with threads.  This does the work
+   * of enforce_constraints_exactly() and
+   * enforce_adjoint_constraints_exactly().
+   */
+  void enforce_constraint_rows_exactly (NumericVector<Number> & v,
+                                        const DofConstraintValueMap * rhs) const;
+
   /**
    * Adds any spline constraints from the Mesh to our DoF constraints.
    * If any Dirichlet constraints exist on spline-constrained nodes,
@@ -1833,6 +2156,88 @@ private:
    */
   bool _constrained_sparsity_construction;
 
+  /**
+   * This flag indicates whether we keep full sparsity patterns in
+   * compressed storage.
+   */
+  bool _compressed_sparsity_storage;
+
+  /**
+   * This flag indicates whether we compute exact nonzero counts when
+   * the full sparsity pattern isn't needed.
+   */
+  bool _exact_sparsity_counts;
+
+  /**
+   * This flag indicates whether we may update sparsity counts
+   * incrementally after adaptive refinement.
+   */
+  bool _incremental_sparsity;
+
+  /**
+   * The number of times distribute_dofs() has been called, so that
+   * incremental sparsity updates can tell whether the old dof objects
+   * still describe the numbering previous counts were computed with.
+   */
+  unsigned int _n_dof_distributions;
+
+  /**
+   * This flag indicates whether distribute_dofs() numbers local dofs
+   * in a bandwidth reducing element order.
+   */
+  bool _bandwidth_reducing_numbering;
+
+  /**
+   * The active local elements, in bandwidth reducing numbering order,
+   * or empty if they are numbered in mesh iteration order.
+   */
+  std::vector<Elem *> _renumbered_elems;
+
+  /**
+   * This flag indicates whether distribute_dofs() caches element dof
+   * indices.
+   */
+  bool _dof_indices_caching;
+
+  /**
+   * The cached dof indices of active local elements, stored by cache
+   * slot (element id minus _dof_indices_cache_first_id) and then by
+   * variable.  The indices for variable vn on the element in slot s
+   * are _dof_indices_cache[_dof_indices_cache_offsets[s*n_vars+vn]]
+   * up to _dof_indices_cache[_dof_indices_cache_offsets[s*n_vars+vn+1]].
+   */
+  dof_id_type _dof_indices_cache_first_id;
+  std::vector<const Elem *> _dof_indices_cache_elems;
+  std::vector<dof_id_type> _dof_indices_cache_offsets;
+  std::vector<dof_id_type> _dof_indices_cache;
+
+  /**
+   * What compute_sparsity() saves for the next incremental update.
+   */
+  struct SparsityHistory
+  {
+    unsigned int dof_distribution;
+    dof_id_type first_dof, end_dof;
+    std::vector<dof_id_type> n_nz, n_oz;
+
+    // Sorted, in the old numbering
+    std::vector<dof_id_type> constrained_dofs;
+  };
+
+  std::unique_ptr<SparsityHistory> _sparsity_history;
+
+  /**
+   * The DofMaps whose sparsity patterns we may copy.
+   */
+  std::vector<const DofMap *> _sparsity_sources;
+
+  /**
+   * The value of _n_dof_distributions when compute_sparsity() last
+   * ran, so that other maps can tell whether our pattern describes
+   * our current numbering.
+   */
+  unsigned int _sparsity_dof_distribution;
+
   /**
    * The finite element type for each variable.
    */
@@ -2029,9 +2434,46 @@ private:
    */
   DofConstraints _dof_constraints, _stashed_dof_constraints;
 
+  /**
+   * Flat lookup tables for \p is_constrained_dof(), built by
+   * \p build_constrained_dof_lookup() once constraints are processed:
+   * one flag per local dof, and a sorted vector of the non-local dofs
+   * we hold constraint rows for.  Only used while
+   * \p _constrained_dof_lookup_valid is true; any change to the set of
+   * constrained dofs invalidates them.
+   */
+  std::vector<bool> _local_constrained_dofs;
+
+  std::vector<dof_id_type> _nonlocal_constrained_dofs;
+
+  bool _constrained_dof_lookup_valid;
+
   DofConstraintValueMap      _primal_constraint_values;
 
   AdjointDofConstraintValues _adjoint_constraint_values;
+
+  /**
+   * Whether to keep the data below for
+   * \p update_dirichlet_constraint_values().
+   */
+  bool _dirichlet_value_updates;
+
+  /**
+   * The constraints and primal values as they were passed to
+   * \p process_constraints(), if \p _dirichlet_value_updates.
+   */
+  std::unique_ptr<DofConstraints> _unprocessed_dof_constraints;
+
+  DofConstraintValueMap _unprocessed_primal_constraint_values;
+
+  /**
+   * The dofs constrained by Dirichlet boundaries, sorted, and the
+   * local active elements those constraints came from, if
+   * \p _dirichlet_value_updates.
+   */
+  std::vector<dof_id_type> _dirichlet_constrained_dofs;
+
+  std::vector<const Elem *> _dirichlet_constrained_elems;
 #endif
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -2178,6 +2620,19 @@ bool DofMap::is_constrained_node (const Node *
 inline
 bool DofMap::is_constrained_dof (const dof_id_type dof) const
 {
+  if (_constrained_dof_lookup_valid)
+    {
+      libmesh_assert_equal_to(_local_constrained_dofs.size(),
+                              this->n_local_dofs());
+
+      const dof_id_type first = this->first_dof();
+      if (dof >= first && dof - first < _local_constrained_dofs.size())
+        return _local_constrained_dofs[dof - first];
+
+      return std::binary_search(_nonlocal_constrained_dofs.begin(),
+                                _nonlocal_constrained_dofs.end(), dof);
+    }
+
   if (_dof_constraints.count(dof))
     return true;
 
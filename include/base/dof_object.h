@@ -27,6 +27,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/small_vector.h"
 
 // C++ includes
 #include <cstddef>
@@ -493,6 +494,12 @@ public:
    */
   unsigned int packed_indexing_size() const;
 
+  /**
+   * \returns An estimate of the heap memory, in bytes, owned by this
+   * object: its index buffer and any old_dof_object.
+   */
+  std::size_t dynamic_memory_size() const;
+
   /**
    * If we have indices packed into an buffer for communications, how
    * much of that buffer applies to this dof object?
@@ -669,9 +676,16 @@ private:
    * [-5 11 11 13 17 () (ncv_0 idx_0 ncv_1 idx_1 ncv_2 idx_2) () (ncv_0 idx_0) (ncv_0 idx_0 ncv_1 idx_1) (xtra1 xtra2)]
    * [0   1  2  3  4         5     6     7     8     9    10         11    12      13    14    15    16      17    18]
    * \endverbatim
+   *
+   * Up to n_inline_indices entries are stored inside the DofObject
+   * itself, which covers one system with up to two variable groups
+   * or two systems with one each, so that in those common cases
+   * objects need no heap allocation for their indices and
+   * dof_indices() lookups don't leave the object.
    */
   typedef dof_id_type index_t;
-  typedef std::vector<index_t> index_buffer_t;
+  static const unsigned int n_inline_indices = 6;
+  typedef small_vector<index_t, n_inline_indices> index_buffer_t;
   index_buffer_t _idx_buf;
 
   /**
@@ -710,7 +724,7 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<dof_id_type> & buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
 #endif
 };
 
@@ -24,17 +24,23 @@
 #ifdef LIBMESH_ENABLE_PERIODIC
 
 // Local Includes
+#include "libmesh/hashing.h"
+#include "libmesh/id_types.h"
+#include "libmesh/threads.h"
 #include "libmesh/vector_value.h" // RealVectorValue
 
 // C++ Includes
 #include <map>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace libMesh
 {
 
 // Forward Declarations
 class Elem;
+class MeshBase;
 class PeriodicBoundaryBase;
 class PointLocatorBase;
 
@@ -64,11 +70,58 @@ public:
   // used to output the side of the neighbor which corresponds to the
   // given \p side of \p e, or invalid_uint if no possible neighbor or
   // no corresponding side exists.
+  //
+  // Neighbors found on the local mesh are cached, so repeated queries
+  // of the same side skip the point location.
   const Elem * neighbor(boundary_id_type boundary_id,
                         const PointLocatorBase & point_locator,
                         const Elem * e,
                         unsigned int side,
                         unsigned int * neigh_side = nullptr) const;
+
+  /**
+   * Forgets all cached periodic neighbors.  This should be called
+   * whenever the mesh, its boundary ids, or the periodic boundaries
+   * themselves have changed; the ghosting functors and \p DofMap do so
+   * from their mesh and dof reinitialization hooks.
+   */
+  void clear_neighbor_cache() const;
+
+private:
+  /**
+   * Does the point location for \p neighbor().
+   */
+  const Elem * find_neighbor(boundary_id_type boundary_id,
+                             const PointLocatorBase & point_locator,
+                             const Elem * e,
+                             unsigned int side,
+                             unsigned int * neigh_side) const;
+
+  /**
+   * A periodic neighbor found for one side of one element.
+   * \p neigh_side is invalid_uint if it was not asked for.
+   */
+  struct CachedNeighbor
+  {
+    boundary_id_type boundary_id;
+    const Elem * elem;
+    const Elem * neighbor;
+    dof_id_type neighbor_id;
+    unsigned int neigh_side;
+  };
+
+  /**
+   * The periodic neighbors found so far, keyed by element id and
+   * side, and the mesh they were found on.  Entries are only used if
+   * the element and the neighbor pointers still match the mesh.
+   */
+  mutable std::unordered_map<std::pair<dof_id_type, unsigned int>,
+                             std::vector<CachedNeighbor>,
+                             libMesh::hash> _neighbor_cache;
+
+  mutable const MeshBase * _neighbor_cache_mesh = nullptr;
+
+  mutable Threads::spin_mutex _neighbor_cache_mutex;
 };
 
 } // namespace libMesh
@@ -53,6 +53,58 @@ class Graph : public std::vector<Row> {};
 
 class NonlocalGraph : public std::map<dof_id_type, Row> {};
 
+/**
+ * A compressed sparse row (CSR) version of a \p Graph: the column
+ * indices of every row are stored back to back in a single array, so
+ * there is no per-row allocation or slack.  The sorted global column
+ * indices of local row \p i are cols[row_offsets[i]] through
+ * cols[row_offsets[i+1]-1].
+ */
+class CompressedGraph
+{
+public:
+  /**
+   * The number of rows.
+   */
+  std::size_t n_rows() const
+  { return row_offsets.empty() ? 0 : row_offsets.size() - 1; }
+
+  /**
+   * The number of entries in row \p i.
+   */
+  std::size_t row_size(std::size_t i) const
+  { return row_offsets[i+1] - row_offsets[i]; }
+
+  /**
+   * Pointers to the beginning and end of the column indices of row \p i.
+   */
+  const dof_id_type * row_begin(std::size_t i) const
+  { return cols.data() + row_offsets[i]; }
+
+  const dof_id_type * row_end(std::size_t i) const
+  { return cols.data() + row_offsets[i+1]; }
+
+  bool empty() const
+  { return row_offsets.empty(); }
+
+  void clear()
+  {
+    row_offsets.clear();
+    cols.clear();
+  }
+
+  /**
+   * Offsets into \p cols of the start of each row, followed by the
+   * total number of entries.
+   */
+  std::vector<std::size_t> row_offsets;
+
+  /**
+   * Column indices of every row, concatenated.
+   */
+  std::vector<dof_id_type> cols;
+};
+
 /**
  * Splices the two sorted ranges [begin,middle) and [middle,end)
  * into one sorted range [begin,end).  This method is much like
@@ -67,6 +119,14 @@ static void sort_row (const BidirectionalIterator begin,
                       BidirectionalIterator       middle,
                       const BidirectionalIterator end);
 
+/**
+ * Merges the sorted, unique entries of \p their_row into the sorted,
+ * unique entries of \p my_row, leaving the result sorted and unique.
+ * Unlike \p sort_row() the two rows may overlap; this is a linear
+ * merge rather than a re-sort of the combined row.
+ */
+void merge_rows (Row & my_row, const Row & their_row);
+
 
 
   /**
@@ -143,6 +203,48 @@ public:
    */
   void parallel_sync ();
 
+  /**
+   * Computes exact, deduplicated n_nz and n_oz counts for \p range
+   * (normally every active local element) without keeping the full
+   * sparsity pattern, then does the parallel_sync() itself.
+   *
+   * A first pass over \p range counts the blocks of couplings which
+   * touch each local row, and a second builds rows as operator()
+   * does but counts and frees each row as soon as its last block has
+   * been added.  Rows which other processors also contribute to are
+   * kept until after the sync.  The element loop is not threaded.
+   *
+   * This is an alternative to operator() plus parallel_sync(), for
+   * use when the full sparsity pattern is not needed.
+   */
+  void count_exactly (const ConstElemRange & range);
+
+  /**
+   * Restricts operator() to building only the local rows flagged in
+   * \p local_rows, indexed by the offset from the first DoF on this
+   * processor, or lifts the restriction if \p local_rows is null.
+   * Nonlocal rows are always built, since only their owners know
+   * whether they are needed.  \p local_rows must stay valid until the
+   * restriction is lifted.
+   */
+  void restrict_rows (const std::vector<bool> * local_rows)
+  { row_filter = local_rows; }
+
+  /**
+   * Sets the counts of every local row left out by restrict_rows()
+   * to the corresponding entries of \p reused_n_nz and \p reused_n_oz.
+   * Used for incremental updates, after parallel_sync().
+   */
+  void reuse_counts (const std::vector<dof_id_type> & reused_n_nz,
+                     const std::vector<dof_id_type> & reused_n_oz);
+
+  /**
+   * Replaces our counts, and whatever full sparsity pattern is kept,
+   * with copies of those in \p other.  Used when \p other was built
+   * for a DofMap known to produce the same pattern as ours.
+   */
+  void copy_pattern (const Build & other);
+
   /**
    * Rows of sparse matrix indices, indexed by the offset from the
    * first DoF on this processor.
@@ -196,8 +298,36 @@ public:
   {
     sparsity_pattern.clear();
     nonlocal_pattern.clear();
+    compressed_pattern.clear();
   }
 
+  /**
+   * Moves the full sparsity pattern into compressed (CSR) storage.
+   * Rows are counted first, so the CSR arrays are allocated once at
+   * their exact size, and each \p Graph row is freed as soon as it
+   * has been copied.  Afterwards get_sparsity_pattern() is empty and
+   * get_compressed_sparsity_pattern() holds the pattern.
+   *
+   * This must be called after parallel_sync() and after any extra
+   * sparsity functions or objects have been applied.
+   */
+  void compress_sparsity();
+
+  /**
+   * The compressed sparsity pattern, indexed by the offset from the
+   * first DoF on this processor.  Empty unless compress_sparsity()
+   * has been called.
+   */
+  const SparsityPattern::CompressedGraph & get_compressed_sparsity_pattern() const
+  { return compressed_pattern; }
+
+  /**
+   * \returns \p true if the full sparsity pattern has been moved into
+   * compressed storage.
+   */
+  bool is_compressed() const
+  { return !compressed_pattern.empty(); }
+
 private:
   const DofMap & dof_map;
   const CouplingMatrix * dof_coupling;
@@ -206,6 +336,13 @@ private:
   const bool need_full_sparsity_pattern;
   const bool calculate_constrained;
 
+  // Whether count_exactly() is computing our counts, in which case
+  // parallel_sync() has to merge rows rather than add counts.
+  bool exact_counts;
+
+  // The local rows to build, if not all of them
+  const std::vector<bool> * row_filter;
+
   // If there are "spider" nodes in the mesh (i.e. a single node which
   // is connected to many 1D elements) and Constraints, we can end up
   // sorting the same set of DOFs multiple times in handle_vi_vj(),
@@ -224,6 +361,15 @@ private:
                              std::vector<dof_id_type> & dofs_vi,
                              unsigned int vi);
 
+  /**
+   * Calls \p visit(element_dofs_i, element_dofs_j) for every block
+   * of couplings, from the element and coupling functor partners, of
+   * each element in \p range.
+   */
+  template <typename Visitor>
+  void visit_couplings(const ConstElemRange & range,
+                       Visitor && visit);
+
 #ifndef LIBMESH_ENABLE_DEPRECATED
 private:
 #endif
@@ -232,6 +378,8 @@ private:
 
   SparsityPattern::NonlocalGraph nonlocal_pattern;
 
+  SparsityPattern::CompressedGraph compressed_pattern;
+
   std::vector<dof_id_type> n_nz;
 
   std::vector<dof_id_type> n_oz;
@@ -40,6 +40,7 @@ enum PartitionerType : int {
                       PARMETIS_PARTITIONER,
                       SUBDOMAIN_PARTITIONER,
                       MAPPED_SUBDOMAIN_PARTITIONER,
+                      HIERARCHICAL_PARTITIONER,
                       // Invalid
                       INVALID_PARTITIONER};
 
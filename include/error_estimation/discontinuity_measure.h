@@ -73,6 +73,9 @@ public:
 
   /**
    * Register a user function to use in computing the essential BCs.
+   *
+   * When libMesh is running with multiple threads, estimate_error()
+   * may call this function concurrently from several threads.
    */
   void attach_essential_bc_function (std::pair<bool,Real> fptr(const System & system,
                                                                const Point & p,
@@ -82,6 +85,11 @@ public:
 
 protected:
 
+  /**
+   * Builds a copy of this estimator for use as a per-thread worker.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone() const override;
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
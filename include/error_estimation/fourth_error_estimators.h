@@ -67,6 +67,11 @@ public:
 
 protected:
 
+  /**
+   * Builds a copy of this estimator for use as a per-thread worker.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone() const override;
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
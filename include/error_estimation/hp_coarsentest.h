@@ -58,6 +58,9 @@ typedef RealTensorValue RealTensor;
  * for h refinement, and we may want to change some of those elements
  * to be flagged for p refinement.
  *
+ * The local projections onto the coarsened spaces are computed in
+ * parallel over threads.
+ *
  * This code is currently experimental and will not produce optimal
  * hp meshes without significant improvement.
  *
@@ -77,17 +80,12 @@ public:
   }
 
   /**
-   * This class cannot be (default) copy constructed/assigned because
-   * it has unique_ptr members. Explicitly deleting these functions is
-   * the best way to document this fact.
-   */
-  HPCoarsenTest (const HPCoarsenTest &) = delete;
-  HPCoarsenTest & operator= (const HPCoarsenTest &) = delete;
-
-  /**
-   * Defaulted move ctor, move assignment operator, and destructor.
+   * Defaulted copy/move ctors, copy/move assignment operators, and
+   * destructor.
    */
+  HPCoarsenTest (const HPCoarsenTest &) = default;
   HPCoarsenTest (HPCoarsenTest &&) = default;
+  HPCoarsenTest & operator= (const HPCoarsenTest &) = default;
   HPCoarsenTest & operator= (HPCoarsenTest &&) = default;
   virtual ~HPCoarsenTest() = default;
 
@@ -117,60 +115,10 @@ public:
 
 protected:
   /**
-   * The helper function which adds individual fine element data to
-   * the coarse element projection
-   */
-  void add_projection(const System &, const Elem *, unsigned int var);
-
-  /**
-   * The coarse element on which a solution projection is cached
-   */
-  Elem * coarse;
-
-  /**
-   * Global DOF indices for fine elements
-   */
-  std::vector<dof_id_type> dof_indices;
-
-  /**
-   * The finite element objects for fine and coarse elements
-   */
-  std::unique_ptr<FEBase> fe, fe_coarse;
-
-  /**
-   * The shape functions and their derivatives
-   */
-  const std::vector<std::vector<Real>> * phi, * phi_coarse;
-  const std::vector<std::vector<RealGradient>> * dphi, * dphi_coarse;
-  const std::vector<std::vector<RealTensor>> * d2phi, * d2phi_coarse;
-
-  /**
-   * Mapping jacobians
-   */
-  const std::vector<Real> * JxW;
-
-  /**
-   * Quadrature locations
-   */
-  const std::vector<Point> * xyz_values;
-  std::vector<Point> coarse_qpoints;
-
-  /**
-   * The quadrature rule for the fine element
-   */
-  std::unique_ptr<QBase> qrule;
-
-  /**
-   * Linear system for projections
-   */
-  DenseMatrix<Number> Ke;
-  DenseVector<Number> Fe;
-  /**
-   * Coefficients for projected coarse and projected
-   * p-derefined solutions
+   * Computes the coarsening errors of one variable on a range of
+   * elements; each thread gets its own.
    */
-  DenseVector<Number> Uc;
-  DenseVector<Number> Up;
+  class ProjectionErrors;
 
   /**
    * Extra order to use for quadrature rule
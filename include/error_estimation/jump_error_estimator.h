@@ -82,6 +82,11 @@ public:
    * estimate formula to estimate the error on each cell.
    * The estimated error is output in the vector
    * \p error_per_cell
+   *
+   * If libMesh is running with more than one thread and the derived
+   * class implements clone(), the active local elements are divided
+   * among the threads, each with its own worker estimator and
+   * FEMContext objects, and the per-thread results are summed.
    */
   virtual void estimate_error (const System & system,
                                ErrorVector & error_per_cell,
@@ -113,6 +118,26 @@ public:
   bool use_unweighted_quadrature_rules;
 
 protected:
+  /**
+   * \returns A new estimator of the same type and with the same
+   * settings as this one, or nullptr if the derived class does not
+   * support being cloned.
+   *
+   * estimate_error() uses clones as per-thread workers, so a derived
+   * class should only implement this if its side integration
+   * functions (and any user callbacks they invoke) are safe to run
+   * concurrently on different elements.  The default implementation
+   * returns nullptr, which makes estimate_error() run serially.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone() const;
+
+  /**
+   * Copies the settings of this estimator (the error norm and the
+   * flags declared in this class) to \p worker.  Intended for use by
+   * derived class implementations of clone().
+   */
+  void copy_settings_to (JumpErrorEstimator & worker) const;
+
   /**
    * A utility function to reinit the finite element data on elements sharing a
    * side
@@ -166,6 +191,31 @@ protected:
    * The variable number currently being evaluated
    */
   unsigned int var;
+
+private:
+
+  /**
+   * Builds fine_context and coarse_context for \p system, and calls
+   * init_context() on each.
+   */
+  void init_contexts (const System & system);
+
+  /**
+   * Computes the jump error contributions from all the sides of the
+   * active element \p e (and, if requested, from its parent), adding
+   * them to \p error_per_cell and \p n_flux_faces.
+   */
+  void estimate_element_error (const System & system,
+                               const Elem * e,
+                               bool estimate_parent_error,
+                               std::vector<ErrorVectorReal> & error_per_cell,
+                               std::vector<float> & n_flux_faces);
+
+  /**
+   * Class to compute jump error contributions on a range of elements
+   * in parallel, accumulating into per-thread vectors.
+   */
+  class EstimateErrors;
 };
 
 
@@ -83,6 +83,9 @@ public:
 
   /**
    * Register a user function to use in computing the flux BCs.
+   *
+   * When libMesh is running with multiple threads, estimate_error()
+   * may call this function concurrently from several threads.
    */
   void attach_flux_bc_function (std::pair<bool,Real> fptr(const System & system,
                                                           const Point & p,
@@ -92,6 +95,11 @@ public:
 
 protected:
 
+  /**
+   * Builds a copy of this estimator for use as a per-thread worker.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone() const override;
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects.
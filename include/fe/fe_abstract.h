@@ -53,6 +53,8 @@ class BoundaryInfo;
 class DofConstraints;
 class DofMap;
 class Elem;
+class ElemSideBuilder;
+class GeometryCache;
 class MeshBase;
 template <typename T> class NumericVector;
 class QBase;
@@ -467,6 +469,23 @@ public:
    */
   virtual void attach_quadrature_rule (QBase * q) = 0;
 
+  /**
+   * Tells the object to save the mapping data it computes on each
+   * element (and element side) at its quadrature rule's points in
+   * \p cache, and to reuse any data already there, rather than
+   * recomputing the map on every reinit().  Passing nullptr turns
+   * this off again.
+   *
+   * The caller is responsible for clearing the cache whenever the
+   * mesh changes.  See GeometryCache.
+   */
+  void set_geometry_cache (GeometryCache * cache) { _geometry_cache = cache; }
+
+  /**
+   * \returns The cache set by set_geometry_cache(), or nullptr.
+   */
+  GeometryCache * get_geometry_cache () const { return _geometry_cache; }
+
   /**
    * \returns The total number of approximation shape functions
    * for the current element.  Useful during matrix assembly.
@@ -754,6 +773,17 @@ protected:
    * Whether to add p-refinement levels in init/reinit methods
    */
   bool _add_p_level_in_reinit;
+
+  /**
+   * Where to save and look up mapping data, if anywhere
+   */
+  GeometryCache * _geometry_cache;
+
+  /**
+   * Reusable storage for the side and edge elements built by side
+   * and edge reinit(), so we don't heap allocate one on every call
+   */
+  std::unique_ptr<ElemSideBuilder> _side_builder;
 };
 
 } // namespace libMesh
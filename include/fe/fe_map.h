@@ -34,6 +34,7 @@ namespace libMesh
 
 // forward declarations
 class Elem;
+class GeometryCache;
 class Node;
 
 /**
@@ -217,6 +218,18 @@ public:
   { libmesh_assert(!calculations_started || calculate_xyz);
     calculate_xyz = true; return xyz; }
 
+  /**
+   * \returns \p true if the most recent compute_map() call was for
+   * an element with an affine map.  In that case the Jacobian, the
+   * inverse map derivatives (dxidx, detady, etc.) and the map
+   * derivatives (dxyzdxi, etc.) are constant over the element, and
+   * entry 0 of each of those vectors is valid for every quadrature
+   * point.  Callers looping over quadrature points can hoist those
+   * values out of the loop.
+   */
+  bool is_affine() const
+  { return _is_affine; }
+
   /**
    * \returns The element Jacobian for each quadrature point.
    */
@@ -1031,7 +1044,17 @@ protected:
    */
   Real jacobian_tolerance;
 
+  /**
+   * Was the most recent compute_map() call for an affine element?
+   */
+  bool _is_affine;
+
 private:
+  /**
+   * GeometryCache stores and restores our quadrature point data.
+   */
+  friend class GeometryCache;
+
   /**
    * A helper function used by FEMap::compute_single_point_map() to
    * compute second derivatives of the inverse map.
@@ -0,0 +1,140 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_REFERENCE_SHAPE_CACHE_H
+#define LIBMESH_FE_REFERENCE_SHAPE_CACHE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_fe_family.h"
+#include "libmesh/enum_quadrature_type.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class implements a process-wide, thread-safe cache of
+ * reference element shape function derivative tables.
+ *
+ * For finite element families whose shape functions do not depend on
+ * the geometry or orientation of the physical element (i.e. when
+ * \p FEAbstract::shapes_need_reinit() returns false), the values of
+ * dphi/dxi and d2phi/dxi2 at the quadrature points depend only on the
+ * element type, the finite element family and (total) order, and the
+ * quadrature rule.  Every FE object in the process, including those
+ * built per-thread, can share these tables read-only instead of
+ * recomputing them whenever the element type passed to reinit()
+ * changes.
+ *
+ * Entries are keyed on (dimension, family, total order, element
+ * type, quadrature type, quadrature order), and the quadrature points
+ * an entry was computed at are stored and checked on lookup, so a
+ * stale or mismatched entry is never returned.
+ *
+ * \date 2023
+ * \brief Shared cache of reference shape function derivatives.
+ */
+template <typename OutputShape>
+class FEReferenceShapeCache
+{
+public:
+
+  /**
+   * (dim, family, total order, element type, quadrature type,
+   * quadrature order)
+   */
+  typedef std::tuple<unsigned int, FEFamily, int, ElemType,
+                     QuadratureType, int> Key;
+
+  /**
+   * The cached reference shape function data for a single key.
+   */
+  struct Entry
+  {
+    /**
+     * The reference points these tables were evaluated at.
+     */
+    std::vector<Point> points;
+
+    /**
+     * Whether first and/or second reference derivatives were
+     * computed for this entry.
+     */
+    bool has_dphiref = false;
+    bool has_d2phiref = false;
+
+    std::vector<std::vector<OutputShape>> dphidxi, dphideta, dphidzeta;
+
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+    std::vector<std::vector<OutputShape>> d2phidxi2, d2phidxideta,
+      d2phideta2, d2phidxidzeta, d2phidetadzeta, d2phidzeta2;
+#endif
+  };
+
+  /**
+   * \returns The entry for \p key if one exists, was computed at
+   * exactly \p points, and contains first (if \p need_dphiref) and
+   * second (if \p need_d2phiref) reference derivatives, or nullptr
+   * otherwise.
+   */
+  static std::shared_ptr<const Entry> find (const Key & key,
+                                            const std::vector<Point> & points,
+                                            bool need_dphiref,
+                                            bool need_d2phiref);
+
+  /**
+   * Adds \p entry to the cache, replacing any existing entry for
+   * \p key.
+   */
+  static void insert (const Key & key,
+                      std::shared_ptr<const Entry> entry);
+
+  /**
+   * Removes all entries from the cache.  Any entries still held by
+   * FE objects remain valid until those objects release them.
+   */
+  static void clear ();
+
+  /**
+   * \returns The number of cached entries.
+   */
+  static std::size_t size ();
+
+  /**
+   * Enables or disables use of the cache by FE::reinit().  The cache
+   * is enabled by default.
+   */
+  static void enable (bool enabled);
+
+  /**
+   * \returns Whether FE::reinit() should use the cache.
+   */
+  static bool enabled ();
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_REFERENCE_SHAPE_CACHE_H
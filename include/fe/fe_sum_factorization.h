@@ -0,0 +1,184 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_SUM_FACTORIZATION_H
+#define LIBMESH_FE_SUM_FACTORIZATION_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <array>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class QBase;
+
+/**
+ * This class evaluates finite element fields and their weak-form
+ * integrals on tensor-product reference elements by sum
+ * factorization: 1D shape function tables are applied one dimension
+ * at a time rather than forming and contracting the full Dim-D shape
+ * function tables.
+ *
+ * For a tensor-product basis with n 1D functions per direction and a
+ * tensor-product quadrature rule with q points per direction, the
+ * full tables cost O(n^Dim q^Dim) work per element, whereas each
+ * operation here costs O(Dim n q^Dim) (when n ~ q).  This makes
+ * residual evaluation and matrix-free operator application affordable
+ * for high polynomial orders.
+ *
+ * Coefficient and residual vectors use the element's usual local
+ * degree of freedom ordering, and quadrature point data uses the
+ * ordering of the \p QBase the object was built with.  Gradients are
+ * with respect to the reference coordinates; the caller is
+ * responsible for applying the inverse mapping Jacobian and the JxW
+ * weights at each quadrature point.
+ *
+ * Currently LAGRANGE bases on QUAD and HEX elements with QGAUSS (or
+ * any other tensor-product) quadrature are supported; see
+ * \p supported().
+ *
+ * \brief Sum-factorized evaluation on tensor-product elements.
+ */
+class FESumFactorization
+{
+public:
+
+  /**
+   * Constructor.  Builds the 1D tables for the basis \p fe_type
+   * (whose order should already include any p refinement) on
+   * elements of type \p elem_type, evaluated at the points of
+   * \p qrule.  It is an error to call this when \p supported()
+   * returns false.
+   */
+  FESumFactorization (const FEType & fe_type,
+                      const ElemType elem_type,
+                      const QBase & qrule);
+
+  /**
+   * \returns Whether sum factorization is available for \p fe_type
+   * on \p elem_type with the quadrature rule \p qrule, i.e. whether
+   * the basis is a tensor product of 1D functions and the points of
+   * \p qrule are a tensor product of a 1D Gauss rule.
+   */
+  static bool supported (const FEType & fe_type,
+                         const ElemType elem_type,
+                         const QBase & qrule);
+
+  /**
+   * \returns The number of degrees of freedom per element.
+   */
+  unsigned int n_dofs () const { return cast_int<unsigned int>(_tensor_index.size()); }
+
+  /**
+   * \returns The number of quadrature points per element.
+   */
+  unsigned int n_qp () const;
+
+  /**
+   * Computes the values at each quadrature point of the field with
+   * local coefficients \p coefs.
+   */
+  void interpolate (const std::vector<Number> & coefs,
+                    std::vector<Number> & values) const;
+
+  /**
+   * Computes the reference-coordinate gradients at each quadrature
+   * point of the field with local coefficients \p coefs.
+   */
+  void interpolate_gradient (const std::vector<Number> & coefs,
+                             std::vector<Gradient> & grads) const;
+
+  /**
+   * Adds \f$ \sum_q \phi_i(q) v_q \f$ to \p residual(i) for every
+   * local basis function, where \p values holds v at each quadrature
+   * point.
+   */
+  void integrate (const std::vector<Number> & values,
+                  std::vector<Number> & residual) const;
+
+  /**
+   * Adds \f$ \sum_q \hat{\nabla} \phi_i(q) \cdot f_q \f$ to
+   * \p residual(i) for every local basis function, where \p fluxes
+   * holds f at each quadrature point with respect to the reference
+   * coordinates.
+   */
+  void integrate_gradient (const std::vector<Gradient> & fluxes,
+                           std::vector<Number> & residual) const;
+
+private:
+
+  /**
+   * Applies the 1D operator \p op (stored row-major, \p op_rows by
+   * \p op_cols, or transposed if \p transpose is true) along
+   * direction \p axis of the tensor \p in with the given
+   * \p extents.  Writes the result to \p out and updates
+   * \p extents.
+   */
+  static void apply_1D (const std::vector<Real> & op,
+                        unsigned int op_rows,
+                        unsigned int op_cols,
+                        bool transpose,
+                        unsigned int axis,
+                        std::array<unsigned int, 3> & extents,
+                        const std::vector<Number> & in,
+                        std::vector<Number> & out);
+
+  /**
+   * Applies \p _phi_1D along every direction but \p deriv_dir and
+   * \p _dphi_1D along \p deriv_dir (no direction, if \p deriv_dir is
+   * \p _dim), in the forward (coefficients to quadrature points) or
+   * transposed direction.
+   */
+  void apply (unsigned int deriv_dir,
+              bool transpose,
+              std::vector<Number> & data) const;
+
+  /**
+   * The element dimension.
+   */
+  unsigned int _dim;
+
+  /**
+   * The number of 1D basis functions and 1D quadrature points.
+   */
+  unsigned int _n_1D, _n_qp_1D;
+
+  /**
+   * The 1D shape functions and their derivatives at the 1D quadrature
+   * points, stored as \p _n_qp_1D rows of \p _n_1D entries.
+   */
+  std::vector<Real> _phi_1D, _dphi_1D;
+
+  /**
+   * The lexicographic tensor index of each local degree of freedom.
+   */
+  std::vector<unsigned int> _tensor_index;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_SUM_FACTORIZATION_H
@@ -29,6 +29,7 @@
 #include "libmesh/hashing.h"
 
 // C++ includes
+#include <algorithm>
 #include <memory>
 #include <functional>
 
@@ -344,6 +345,28 @@ public:
   std::unique_ptr<QBase> unweighted_quadrature_rule (const unsigned int dim,
                                                      const int extraorder=0) const;
 
+  /**
+   * \returns The lowest quadrature order which exactly integrates the
+   * product of two basis functions of this \p FEType on affine
+   * elements with constant coefficients, when \p n_derivatives
+   * derivatives are taken in total: 0 for a mass matrix, 1 for a
+   * convection term, and 2 for a stiffness matrix.  Unlike
+   * default_quadrature_order(), no extra power is added to account for
+   * nonlinearities or nonuniform coefficients.
+   */
+  Order affine_quadrature_order (const unsigned int n_derivatives=0) const;
+
+  /**
+   * \returns A quadrature rule of order affine_quadrature_order(\p
+   * n_derivatives) plus \p extraorder.  This is only exact on elements
+   * with affine maps; families whose shape functions are not
+   * polynomials on the reference element get the
+   * default_quadrature_rule() instead.
+   */
+  std::unique_ptr<QBase> affine_quadrature_rule (const unsigned int dim,
+                                                 const unsigned int n_derivatives=0,
+                                                 const int extraorder=0) const;
+
 
 private:
 
@@ -365,6 +388,13 @@ Order FEType::unweighted_quadrature_order () const
   return order;
 }
 
+inline
+Order FEType::affine_quadrature_order (const unsigned int n_derivatives) const
+{
+  const unsigned int mass_order = 2*static_cast<unsigned int>(order.get_order());
+  return static_cast<Order>(mass_order - std::min(n_derivatives, mass_order));
+}
+
 } // namespace libMesh
 
 namespace std
@@ -0,0 +1,204 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+
+#ifndef LIBMESH_GEOMETRY_CACHE_H
+#define LIBMESH_GEOMETRY_CACHE_H
+
+// libMesh includes
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
+#include "libmesh/threads.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <cstddef>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class FEMap;
+
+/**
+ * Stores the results of FEMap::compute_map() and
+ * FEMap::compute_face_map() for each element (and element side) at
+ * the quadrature points of a rule, so that repeated reinit() calls on
+ * a mesh which isn't changing, e.g. over the iterations of a Newton
+ * solve, can copy the geometric factors (xyz, JxW, the map
+ * derivatives and their inverses, normals and tangents) instead of
+ * recomputing them.
+ *
+ * The cache is opt-in: an FE object only uses it after
+ * FEAbstract::set_geometry_cache() has been called, and only when its
+ * quadrature rule (rather than user-supplied points) is being used.
+ * Maps which need second derivatives are never cached.  The quadrature
+ * points and weights are stored with each entry and checked when it is
+ * looked up, so a change of rule or of element p level just results
+ * in a recomputation.  Entries are never replaced, though, so the
+ * cache should be cleared after switching rules for good.
+ *
+ * For elements with affine maps only one value of each map derivative
+ * is stored, rather than one per quadrature point.
+ *
+ * The cache knows nothing about node positions: whoever owns it must
+ * clear() it whenever the mesh changes or is displaced.  Lookups and
+ * insertions are thread safe; clear() is not, and must not be called
+ * while the cache is in use.
+ *
+ * \brief Caches per-element mapping data across reinit() calls.
+ */
+class GeometryCache
+{
+public:
+  GeometryCache () = default;
+
+  /**
+   * If an entry for the interior of \p elem, at the quadrature points
+   * \p qp with weights \p qw, is stored and contains the quantities
+   * \p map is set up to calculate, copies it into \p map and returns
+   * \p true.  Otherwise returns \p false.
+   */
+  bool restore_map (FEMap & map,
+                    const Elem & elem,
+                    const std::vector<Point> & qp,
+                    const std::vector<Real> & qw) const;
+
+  /**
+   * Stores the results of the last FEMap::compute_map() call on
+   * \p map, which must have been for the interior of \p elem at the
+   * quadrature points \p qp with weights \p qw.
+   */
+  void store_map (const FEMap & map,
+                  const Elem & elem,
+                  const std::vector<Point> & qp,
+                  const std::vector<Real> & qw);
+
+  /**
+   * If an entry for side \p s of \p elem, at the side quadrature
+   * points \p qp with weights \p qw, is stored and contains the
+   * quantities \p map is set up to calculate, copies its face map
+   * data into \p map, copies the locations of the quadrature points
+   * on the reference interior element into \p interior_qp, and
+   * returns \p true.  Otherwise returns \p false.
+   */
+  bool restore_face_map (FEMap & map,
+                         const Elem & elem,
+                         unsigned int s,
+                         const std::vector<Point> & qp,
+                         const std::vector<Real> & qw,
+                         std::vector<Point> & interior_qp) const;
+
+  /**
+   * Stores the results of the last FEMap::compute_face_map() call on
+   * \p map, which must have been for side \p s of \p elem at the side
+   * quadrature points \p qp with weights \p qw, along with the
+   * locations \p interior_qp of those points on the reference
+   * interior element.
+   */
+  void store_face_map (const FEMap & map,
+                       const Elem & elem,
+                       unsigned int s,
+                       const std::vector<Point> & qp,
+                       const std::vector<Real> & qw,
+                       const std::vector<Point> & interior_qp);
+
+  /**
+   * Discards all stored data.  This must be called whenever the
+   * mesh the data was computed on changes.
+   */
+  void clear ();
+
+  /**
+   * \returns The number of element interiors and sides with stored
+   * data.
+   */
+  std::size_t n_entries () const;
+
+  /**
+   * \returns An estimate of the memory, in bytes, used by the stored
+   * data.
+   */
+  std::size_t memory_usage () const;
+
+private:
+
+  /**
+   * The mapping data for one element interior or side.  For affine
+   * maps the derivative vectors hold a single value.
+   */
+  struct Entry
+  {
+    bool is_affine = false;
+
+    std::vector<Point> qp;
+    std::vector<Real> qw;
+
+    std::vector<Point> xyz;
+    std::vector<RealGradient> dxyzdxi, dxyzdeta, dxyzdzeta;
+    std::vector<Real> dxidx, dxidy, dxidz;
+    std::vector<Real> detadx, detady, detadz;
+    std::vector<Real> dzetadx, dzetady, dzetadz;
+    std::vector<Real> jac, JxW;
+
+    std::vector<Point> normals;
+    std::vector<std::vector<Point>> tangents;
+    std::vector<Point> interior_qp;
+
+    std::size_t memory_usage () const;
+  };
+
+  /**
+   * Entries are keyed on the element id, the side number (or
+   * invalid_uint for the interior), and whether xyz and the map
+   * derivatives were calculated.
+   */
+  typedef std::tuple<dof_id_type, unsigned int, bool, bool> Key;
+
+  /**
+   * \returns The entry for \p key if one is stored and was computed
+   * at the points \p qp with weights \p qw, otherwise nullptr.
+   */
+  const Entry * find (const Key & key,
+                      const std::vector<Point> & qp,
+                      const std::vector<Real> & qw) const;
+
+  /**
+   * Inserts \p entry under \p key, unless another thread got there
+   * first.
+   */
+  void insert (const Key & key, Entry && entry);
+
+  /**
+   * std::map never invalidates references to its values on
+   * insertion, so entries can be read without holding the lock.
+   */
+  std::map<Key, Entry> _entries;
+
+  mutable Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_GEOMETRY_CACHE_H
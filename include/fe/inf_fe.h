@@ -915,6 +915,10 @@ protected:
    * Some of the member data only depend on the radial part of the
    * infinite element.  The parts that only change when the radial
    * order changes, are initialized here.
+   *
+   * The radial tables are kept between calls, and are only
+   * re-evaluated when the radial order, the radial points or the
+   * requested quantities change.
    */
   void init_radial_shape_functions(const Elem * inf_elem,
                                    const std::vector<Point> * radial_pts = nullptr);
@@ -1081,6 +1085,23 @@ protected:
    */
   std::vector<std::vector<Real>> dmodedv;
 
+  /**
+   * The radial tables combined with the radial decay, \p mode times
+   * \p som and its first local derivative, so the shape functions
+   * only need one product with the base shapes per point.
+   */
+  std::vector<std::vector<Real>> modexsom;
+  std::vector<std::vector<Real>> dmodexsomdv;
+
+  /**
+   * The radial order, radial points and requested quantities for
+   * which the radial tables above were last evaluated.
+   */
+  Order _radial_table_order;
+  std::vector<Point> _radial_table_points;
+  bool _radial_table_values;
+  bool _radial_table_derivs;
+
   // mapping of reference element to physical element
   // These vectors usually belong to \p this->fe_map
   // but for infinite elements, \p FEMap cannot
@@ -198,6 +198,15 @@ public:
    */
   virtual bool contains_point (const Point & p, Real tol=TOLERANCE) const override;
 
+  /**
+   * Our contains_point() specialization doesn't use the generic
+   * bounding box test, so just call it for each point.
+   */
+  virtual void contains_points (const std::vector<Point> & points,
+                                std::vector<bool> & contained,
+                                Real tol=TOLERANCE) const override
+  { this->contains_each_point(points, contained, tol); }
+
   /**
    * One non-infinite side, four orientations.
    */
@@ -32,6 +32,7 @@
 #include "libmesh/pointer_to_pointer_iter.h"
 #include "libmesh/int_range.h"
 #include "libmesh/simple_range.h"
+#include "libmesh/slab_pool.h"
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/hashword.h" // Used in compute_key() functions
 
@@ -129,6 +130,16 @@ public:
    */
   virtual ~Elem() = default;
 
+  /**
+   * Elements are allocated through \p SlabPool, which batches them
+   * into large slabs when "--pool-mesh-objects" is given.
+   */
+  static void * operator new (std::size_t size)
+  { return SlabPool::allocate(size); }
+
+  static void operator delete (void * p, std::size_t size)
+  { SlabPool::deallocate(p, size); }
+
   /**
    * \returns The \p Point associated with local \p Node \p i.
    */
@@ -1022,6 +1033,35 @@ public:
    */
   virtual bool close_to_point(const Point & p, Real tol) const;
 
+  /**
+   * Sets \p contained[i] to \p true if \p points[i] is contained in
+   * this element, giving the same results as contains_point() would
+   * for each point.
+   *
+   * For linear elements, the bounding box used to screen out points
+   * (and the element's hmax()) is computed once for all the points,
+   * rather than once per point, and only points which pass the
+   * screening go on to inverse_map().  This makes testing batches of
+   * points, e.g. particles which may have moved into an element, much
+   * cheaper than repeated contains_point() calls.
+   *
+   * Subclasses which override contains_point() should override this
+   * too.
+   */
+  virtual void contains_points (const std::vector<Point> & points,
+                                std::vector<bool> & contained,
+                                Real tol=TOLERANCE) const;
+
+protected:
+  /**
+   * Implements contains_points() with one contains_point() call per
+   * point, for subclasses whose contains_point() specializations are
+   * already cheap.
+   */
+  void contains_each_point (const std::vector<Point> & points,
+                            std::vector<bool> & contained,
+                            Real tol) const;
+
 private:
   /**
    * Shared private implementation used by the contains_point()
@@ -1031,6 +1071,13 @@ private:
    */
   bool point_test(const Point & p, Real box_tol, Real map_tol) const;
 
+  /**
+   * The inverse_map() part of point_test(), shared with
+   * contains_points().  \p my_hmax must be this->hmax() if this is a
+   * 1D or 2D element, and is unused otherwise.
+   */
+  bool mapped_point_test(const Point & p, Real map_tol, Real my_hmax) const;
+
 public:
   /**
    * \returns \p true if the element map is definitely affine (i.e. the same at
@@ -1547,6 +1594,66 @@ public:
                                                    const PeriodicBoundaries * pb,
                                                    bool reset = true);
 
+  /**
+   * Calls \p visit on every element the \p family_tree() member
+   * would add, in the same order, without building a container.
+   * The visitor is passed a pointer to each element.
+   */
+  template <typename Visitor>
+  void visit_family_tree (Visitor && visit) const;
+
+  /**
+   * Non-const version of function above; visits non-const pointers.
+   */
+  template <typename Visitor>
+  void visit_family_tree (Visitor && visit);
+
+  /**
+   * Calls \p visit on every element the \p active_family_tree()
+   * member would add, in the same order, without building a
+   * container.
+   */
+  template <typename Visitor>
+  void visit_active_family_tree (Visitor && visit) const;
+
+  /**
+   * Non-const version of function above; visits non-const pointers.
+   */
+  template <typename Visitor>
+  void visit_active_family_tree (Visitor && visit);
+
+  /**
+   * Calls \p visit on every element the \p active_family_tree_by_side()
+   * member would add, in the same order, without building a
+   * container.
+   */
+  template <typename Visitor>
+  void visit_active_family_tree_by_side (unsigned int side,
+                                         Visitor && visit) const;
+
+  /**
+   * Non-const version of function above; visits non-const pointers.
+   */
+  template <typename Visitor>
+  void visit_active_family_tree_by_side (unsigned int side,
+                                         Visitor && visit);
+
+  /**
+   * Calls \p visit on every element the
+   * \p active_family_tree_by_neighbor() member would add, in the same
+   * order, without building a container.
+   */
+  template <typename Visitor>
+  void visit_active_family_tree_by_neighbor (const Elem * neighbor,
+                                             Visitor && visit) const;
+
+  /**
+   * Non-const version of function above; visits non-const pointers.
+   */
+  template <typename Visitor>
+  void visit_active_family_tree_by_neighbor (const Elem * neighbor,
+                                             Visitor && visit);
+
   /**
    * \returns The value of the refinement flag for the element.
    */
@@ -2174,6 +2281,135 @@ SimpleRange<Elem::ConstChildRefIter> Elem::child_ref_range() const
   libmesh_assert(_children);
   return {_children.get(), _children.get() + this->n_children()};
 }
+
+
+
+template <typename Visitor>
+inline
+void Elem::visit_family_tree (Visitor && visit) const
+{
+  // The "family tree" doesn't include subactive elements
+  libmesh_assert(!this->subactive());
+
+  visit(this);
+
+  if (!this->active())
+    for (auto & c : this->child_ref_range())
+      if (!c.is_remote())
+        c.visit_family_tree(visit);
+}
+
+
+
+template <typename Visitor>
+inline
+void Elem::visit_family_tree (Visitor && visit)
+{
+  const Elem & me = *this;
+  me.visit_family_tree([&visit](const Elem * elem)
+                       { visit(const_cast<Elem *>(elem)); });
+}
+
+
+
+template <typename Visitor>
+inline
+void Elem::visit_active_family_tree (Visitor && visit) const
+{
+  // The "family tree" doesn't include subactive elements
+  libmesh_assert(!this->subactive());
+
+  if (this->active())
+    visit(this);
+  else
+    for (auto & c : this->child_ref_range())
+      if (!c.is_remote())
+        c.visit_active_family_tree(visit);
+}
+
+
+
+template <typename Visitor>
+inline
+void Elem::visit_active_family_tree (Visitor && visit)
+{
+  const Elem & me = *this;
+  me.visit_active_family_tree([&visit](const Elem * elem)
+                              { visit(const_cast<Elem *>(elem)); });
+}
+
+
+
+template <typename Visitor>
+inline
+void Elem::visit_active_family_tree_by_side (unsigned int side,
+                                             Visitor && visit) const
+{
+  // The "family tree" doesn't include subactive or remote elements
+  libmesh_assert(!this->subactive());
+  libmesh_assert(!this->is_remote());
+  libmesh_assert_less (side, this->n_sides());
+
+  if (this->active())
+    visit(this);
+  else
+    {
+      const unsigned int nc = this->n_children();
+      for (unsigned int c = 0; c != nc; c++)
+        if (!this->child_ptr(c)->is_remote() && this->is_child_on_side(c, side))
+          this->child_ptr(c)->visit_active_family_tree_by_side(side, visit);
+    }
+}
+
+
+
+template <typename Visitor>
+inline
+void Elem::visit_active_family_tree_by_side (unsigned int side,
+                                             Visitor && visit)
+{
+  const Elem & me = *this;
+  me.visit_active_family_tree_by_side(side, [&visit](const Elem * elem)
+                                      { visit(const_cast<Elem *>(elem)); });
+}
+
+
+
+template <typename Visitor>
+inline
+void Elem::visit_active_family_tree_by_neighbor (const Elem * neighbor,
+                                                 Visitor && visit) const
+{
+  // The "family tree" doesn't include subactive elements or
+  // remote_elements
+  libmesh_assert(!this->subactive());
+  libmesh_assert(!this->is_remote());
+
+  // This only makes sense if we're already a neighbor
+#ifndef NDEBUG
+  if (this->level() >= neighbor->level())
+    libmesh_assert (this->has_neighbor(neighbor));
+#endif
+
+  if (this->active())
+    visit(this);
+  else
+    for (auto & c : this->child_ref_range())
+      if (!c.is_remote() && c.has_neighbor(neighbor))
+        c.visit_active_family_tree_by_neighbor(neighbor, visit);
+}
+
+
+
+template <typename Visitor>
+inline
+void Elem::visit_active_family_tree_by_neighbor (const Elem * neighbor,
+                                                 Visitor && visit)
+{
+  const Elem & me = *this;
+  me.visit_active_family_tree_by_neighbor(neighbor, [&visit](const Elem * elem)
+                                          { visit(const_cast<Elem *>(elem)); });
+}
 #endif // LIBMESH_ENABLE_AMR
 
 
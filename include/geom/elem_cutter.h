@@ -125,6 +125,24 @@ public:
   const std::vector<Elem const *> & outside_elements() const
   { return _outside_elem; }
 
+  /**
+   * \returns The vertices of the simplices (edges, triangles or
+   * tetrahedra) whose union is the inside portion of the last cut
+   * element, if that element was a simplex. Simplices are cut by a
+   * plane using a lookup table on the signs of the vertex distances,
+   * without calling a mesh generator, and inside_elements() is built
+   * from these. The list is empty for other element types.
+   */
+  const std::vector<std::vector<Point>> & inside_simplices () const
+  { return _inside_simplices; }
+
+  /**
+   * \returns The vertices of the simplices whose union is the outside
+   * portion of the last cut element, if that element was a simplex.
+   */
+  const std::vector<std::vector<Point>> & outside_simplices () const
+  { return _outside_simplices; }
+
 protected:
 
   /**
@@ -134,6 +152,14 @@ protected:
   void find_intersection_points(const Elem & elem,
                                 const std::vector<Real> & vertex_distance_func);
 
+  /**
+   * Cutting algorithm for simplices in any dimension, which uses the
+   * straight-line interpolation of the distance function between
+   * vertices.
+   */
+  void cut_simplex(const Elem & elem,
+                   const std::vector<Real> & vertex_distance_func);
+
   /**
    * cutting algorithm in 1D.
    */
@@ -170,6 +196,12 @@ protected:
   std::unique_ptr<TetGenMeshInterface> _tetgen_outside;
 
   std::vector<Point> _intersection_pts;
+
+  std::vector<std::vector<Point>> _inside_simplices;
+  std::vector<std::vector<Point>> _outside_simplices;
+
+  std::unique_ptr<ReplicatedMesh> _inside_mesh_simplex;
+  std::unique_ptr<ReplicatedMesh> _outside_mesh_simplex;
 };
 
 
@@ -42,22 +42,11 @@ family_tree (T elem,
              std::vector<T> & family,
              bool reset = true)
 {
-  // The "family tree" doesn't include subactive elements
-  libmesh_assert(!elem->subactive());
-
   // Clear the vector if the flag reset tells us to.
   if (reset)
     family.clear();
 
-  // Add this element to the family tree.
-  family.push_back(elem);
-
-  // Recurse into the elements children, if it has them.
-  // Do not clear the vector any more.
-  if (!elem->active())
-    for (auto & c : elem->child_ref_range())
-      if (!c.is_remote())
-        ElemInternal::family_tree (&c, family, false);
+  elem->visit_family_tree([&family](T e) { family.push_back(e); });
 }
 
 
@@ -91,23 +80,11 @@ active_family_tree(T elem,
                    std::vector<T> & active_family,
                    bool reset = true)
 {
-  // The "family tree" doesn't include subactive elements
-  libmesh_assert(!elem->subactive());
-
   // Clear the vector if the flag reset tells us to.
   if (reset)
     active_family.clear();
 
-  // Add this element to the family tree if it is active
-  if (elem->active())
-    active_family.push_back(elem);
-
-  // Otherwise recurse into the element's children.
-  // Do not clear the vector any more.
-  else
-    for (auto & c : elem->child_ref_range())
-      if (!c.is_remote())
-        ElemInternal::active_family_tree (&c, active_family, false);
+  elem->visit_active_family_tree([&active_family](T e) { active_family.push_back(e); });
 }
 
 
@@ -151,29 +128,11 @@ active_family_tree_by_side (T elem,
                             unsigned int side,
                             bool reset = true)
 {
-  // The "family tree" doesn't include subactive or remote elements
-  libmesh_assert(!elem->subactive());
-  libmesh_assert(!elem->is_remote());
-
   // Clear the vector if the flag reset tells us to.
   if (reset)
     family.clear();
 
-  libmesh_assert_less (side, elem->n_sides());
-
-  // Add an active element to the family tree.
-  if (elem->active())
-    family.push_back(elem);
-
-  // Or recurse into an ancestor element's children.
-  // Do not clear the vector any more.
-  else
-    {
-      const unsigned int nc = elem->n_children();
-      for (unsigned int c = 0; c != nc; c++)
-        if (!elem->child_ptr(c)->is_remote() && elem->is_child_on_side(c, side))
-          ElemInternal::active_family_tree_by_side(elem->child_ptr(c), family, side, false);
-    }
+  elem->visit_active_family_tree_by_side(side, [&family](T e) { family.push_back(e); });
 }
 
 
@@ -322,31 +281,11 @@ active_family_tree_by_neighbor(T elem,
                                T neighbor_in,
                                bool reset = true)
 {
-  // The "family tree" doesn't include subactive elements or
-  // remote_elements
-  libmesh_assert(!elem->subactive());
-  libmesh_assert(!elem->is_remote());
-
   // Clear the vector if the flag reset tells us to.
   if (reset)
     family.clear();
 
-  // This only makes sense if we're already a neighbor
-#ifndef NDEBUG
-  if (elem->level() >= neighbor_in->level())
-    libmesh_assert (elem->has_neighbor(neighbor_in));
-#endif
-
-  // Add an active element to the family tree.
-  if (elem->active())
-    family.push_back(elem);
-
-  // Or recurse into an ancestor element's children.
-  // Do not clear the vector any more.
-  else if (!elem->active())
-    for (auto & c : elem->child_ref_range())
-      if (!c.is_remote() && c.has_neighbor(neighbor_in))
-        ElemInternal::active_family_tree_by_neighbor (&c, family, neighbor_in, false);
+  elem->visit_active_family_tree_by_neighbor(neighbor_in, [&family](T e) { family.push_back(e); });
 }
 
 
@@ -409,8 +348,19 @@ find_point_neighbors(T this_elem,
   neighbor_set.clear();
   neighbor_set.insert(start_elem);
 
-  std::set<T> untested_set, next_untested_set;
-  untested_set.insert(start_elem);
+  // Anything we add to next_untested_set is new to neighbor_set, so
+  // these never hold duplicates and needn't be sets themselves.
+  std::vector<T> untested_set, next_untested_set;
+  untested_set.push_back(start_elem);
+
+  // Add a touching element, and queue it for testing, if it's new
+  auto add_if_touching = [this_elem, &neighbor_set, &next_untested_set](T current)
+    {
+      if (this_elem->contains_vertex_of(current, true) ||
+          current->contains_vertex_of(this_elem, true))
+        if (neighbor_set.insert(current).second)
+          next_untested_set.push_back(current);
+    };
 
   while (!untested_set.empty())
     {
@@ -423,40 +373,12 @@ find_point_neighbors(T this_elem,
                   !current_neighbor->is_remote())    // we have a real neighbor on this side
                 {
                   if (current_neighbor->active())                // ... if it is active
-                    {
-                      if (this_elem->contains_vertex_of(current_neighbor, true) // ... and touches us
-                          || current_neighbor->contains_vertex_of(this_elem, true))
-                        {
-                          // Make sure we'll test it
-                          if (!neighbor_set.count(current_neighbor))
-                            next_untested_set.insert (current_neighbor);
-
-                          // And add it
-                          neighbor_set.insert (current_neighbor);
-                        }
-                    }
+                    add_if_touching(current_neighbor);           // ... and touches us
 #ifdef LIBMESH_ENABLE_AMR
                   else                                 // ... the neighbor is *not* active,
-                    {                                  // ... so add *all* neighboring
+                    current_neighbor->visit_active_family_tree_by_neighbor
+                      (elem, add_if_touching);         // ... so add *all* neighboring
                                                        // active children
-                      std::vector<T> active_neighbor_children;
-
-                      current_neighbor->active_family_tree_by_neighbor
-                        (active_neighbor_children, elem);
-
-                      for (const auto & current_child : active_neighbor_children)
-                        {
-                          if (this_elem->contains_vertex_of(current_child, true) ||
-                              current_child->contains_vertex_of(this_elem, true))
-                            {
-                              // Make sure we'll test it
-                              if (!neighbor_set.count(current_child))
-                                next_untested_set.insert (current_child);
-
-                              neighbor_set.insert (current_child);
-                            }
-                        }
-                    }
 #endif // #ifdef LIBMESH_ENABLE_AMR
                 }
             }
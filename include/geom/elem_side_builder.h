@@ -43,6 +43,8 @@ namespace libMesh
  * used and the necessary members (nodes and subdomain)
  * are changed in place.
  *
+ * Edges are built the same way, from a separate cache.
+ *
  * NOTE: This tool is meant for on-the-fly use. Because
  * the cache is changed on each call, the references obtained
  * from previous calls should be considered invalid.
@@ -58,9 +60,21 @@ public:
   const Elem & operator()(const Elem & elem, const unsigned int s);
   ///@}
 
+  /**
+   * \returns an element edge for edge \p e of element \p elem.
+   */
+  ///@{
+  Elem & edge(Elem & elem, const unsigned int e);
+  const Elem & edge(const Elem & elem, const unsigned int e);
+  ///@}
+
 private:
   /// Element cache for building sides; indexed by ElemType
   std::vector<std::unique_ptr<Elem>> _cached_elems;
+
+  /// Element cache for building edges; every edge of most element
+  /// types has the same type, so one entry is enough
+  std::unique_ptr<Elem> _cached_edge;
 };
 
 } // namespace libMesh
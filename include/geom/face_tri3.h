@@ -192,6 +192,15 @@ public:
    */
   virtual bool contains_point (const Point & p, Real tol) const override;
 
+  /**
+   * Our contains_point() is already cheap, so just call it for each
+   * point.
+   */
+  virtual void contains_points (const std::vector<Point> & points,
+                                std::vector<bool> & contained,
+                                Real tol=TOLERANCE) const override
+  { this->contains_each_point(points, contained, tol); }
+
   /**
    * Builds a bounding box out of the nodal positions
    */
@@ -24,6 +24,7 @@
 #include "libmesh/point.h"
 #include "libmesh/dof_object.h"
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/slab_pool.h"
 
 // C++ includes
 #include <iostream>
@@ -100,6 +101,16 @@ public:
    */
   ~Node ();
 
+  /**
+   * Nodes are allocated through \p SlabPool, which batches them into
+   * large slabs when "--pool-mesh-objects" is given.
+   */
+  static void * operator new (std::size_t size)
+  { return SlabPool::allocate(size); }
+
+  static void operator delete (void * p, std::size_t size)
+  { SlabPool::deallocate(p, size); }
+
   /**
    * Assign to a node from a point.
    */
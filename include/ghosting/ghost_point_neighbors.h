@@ -104,6 +104,13 @@ public:
                            processor_id_type p,
                            map_type & coupled_elements) override;
 
+  /**
+   * We only keep per-call data, and our point locator is built
+   * before any threaded query, so we can be queried from several
+   * threads at once.
+   */
+  virtual bool is_thread_safe () const override { return true; }
+
 private:
 #ifdef LIBMESH_ENABLE_PERIODIC
   const PeriodicBoundaries * _periodic_bcs;
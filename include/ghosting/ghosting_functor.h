@@ -255,6 +255,32 @@ public:
                            processor_id_type p,
                            map_type & coupled_elements) = 0;
 
+  /**
+   * GhostingFunctor subclasses whose operator() may be called
+   * concurrently from several threads, on different element ranges,
+   * should override this to return \p true.  Such functors must also
+   * give the same CouplingMatrix for an element however the range
+   * containing its neighbors is divided up, so that results from
+   * different threads can be merged.
+   *
+   * The default is \p false: functors are only called from one
+   * thread at a time.
+   */
+  virtual bool is_thread_safe () const { return false; }
+
+  /**
+   * Adds the results of operator() on the specified range to
+   * \p coupled_elements.  If is_thread_safe() returns \p true, we
+   * are running with more than one thread, and we are not already
+   * inside a threaded loop, then the range is divided among threads
+   * and the results of each are merged.  Otherwise this just calls
+   * operator().
+   */
+  void query (const MeshBase::const_element_iterator & range_begin,
+              const MeshBase::const_element_iterator & range_end,
+              processor_id_type p,
+              map_type & coupled_elements);
+
   /**
    * GhostingFunctor subclasses which cache data will need to
    * initialize that cache.  We call mesh_reinit() whenever the
@@ -22,9 +22,13 @@
 
 // Local Includes
 #include "libmesh/ghosting_functor.h"
+#include "libmesh/threads.h"
 
 // C++ Includes
 #include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace libMesh
 {
@@ -87,6 +91,11 @@ public:
   void set_n_levels(unsigned int n_levels)
   { _n_levels = n_levels; }
 
+  /**
+   * Changing the mesh invalidates our cached neighbors.
+   */
+  virtual void set_mesh (const MeshBase * mesh) override;
+
 #ifdef LIBMESH_ENABLE_PERIODIC
   // Set PeriodicBoundaries to couple.
   //
@@ -96,11 +105,17 @@ public:
 #endif
 
   /**
-   * If we have periodic boundaries, then we'll need the mesh to have
-   * an updated point locator whenever we're about to query them.
+   * Discards our cached point neighbors.  If we have periodic
+   * boundaries, then we'll also need the mesh to have an updated
+   * point locator whenever we're about to query them.
    */
   virtual void mesh_reinit () override;
 
+  /**
+   * Discards our cached point neighbors.
+   */
+  virtual void dofmap_reinit () override;
+
   virtual void redistribute () override
   { this->mesh_reinit(); }
 
@@ -119,13 +134,43 @@ public:
                            processor_id_type p,
                            map_type & coupled_elements) override;
 
+  /**
+   * Our cached data is mutex-protected and our point locator is
+   * built before any threaded query, so we can be queried from
+   * several threads at once.
+   */
+  virtual bool is_thread_safe () const override { return true; }
+
 private:
 
+  /**
+   * Fills \p neighbors with the point neighbors of \p elem.  These
+   * are found on the first request for each element and cached
+   * after that, unless they might include remote elements.
+   */
+  void point_neighbors (const Elem * elem,
+                        std::vector<const Elem *> & neighbors);
+
   const CouplingMatrix * _dof_coupling;
 #ifdef LIBMESH_ENABLE_PERIODIC
   const PeriodicBoundaries * _periodic_bcs;
 #endif
   unsigned int _n_levels;
+
+  /**
+   * The cached results of point_neighbors(), keyed by element id.
+   * The element itself is stored too, so that an id which has been
+   * reused by another element isn't mistaken for a cache hit.
+   * Cleared by mesh_reinit() and dofmap_reinit().
+   */
+  std::unordered_map<dof_id_type,
+                     std::pair<const Elem *, std::vector<const Elem *>>>
+    _point_neighbors;
+
+  /**
+   * Sparsity pattern construction calls us from multiple threads.
+   */
+  Threads::spin_mutex _point_neighbors_mutex;
 };
 
 } // namespace libMesh
@@ -68,6 +68,12 @@ public:
                            processor_id_type p,
                            map_type & coupled_elements) override;
 
+  /**
+   * We keep no state between calls, so we can be queried from
+   * several threads at once.
+   */
+  virtual bool is_thread_safe () const override { return true; }
+
    /**
     * A clone() is needed because GhostingFunctor can not be shared between
     * different meshes. The operations in  GhostingFunctor are mesh dependent.
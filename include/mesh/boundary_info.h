@@ -31,6 +31,7 @@
 #include <set>
 #include <vector>
 #include <tuple>
+#include <unordered_set>
 
 namespace libMesh
 {
@@ -923,8 +924,33 @@ public:
   void allow_children_on_boundary_side(const bool children_on_boundary)
   { _children_on_boundary = children_on_boundary; }
 
+  /**
+   * \returns \p true if \p elem itself has any sides stored in the
+   * sideset map.  Ancestors of \p elem are not searched.
+   *
+   * After regenerate_id_sets() (e.g. in MeshBase::prepare_for_use())
+   * this is a hash lookup rather than a search of the sideset map;
+   * in between, any modification of the sideset map falls back on
+   * the search.
+   */
+  bool has_boundary_sides (const Elem * const elem) const;
+
 private:
 
+  /**
+   * Marks the _elems_with_boundary_sides lookup as stale.  Must be
+   * called by anything which modifies _boundary_side_id.
+   */
+  void _invalidate_side_lookup ()
+  { _elems_with_boundary_sides_valid = false; }
+
+  /**
+   * \returns \p false if \p elem is known to have no entries in
+   * _boundary_side_id, \p true if it has or might have some.
+   */
+  bool _may_have_boundary_sides (const Elem * const elem) const
+  { return !_elems_with_boundary_sides_valid || _elems_with_boundary_sides.count(elem); }
+
   /**
    * Helper method for finding consistent maps of interior to boundary
    * dof_object ids.  Either node_id_map or side_id_map can be nullptr,
@@ -937,6 +963,18 @@ private:
                       std::map<std::pair<dof_id_type, unsigned char>, dof_id_type> * side_id_map,
                       const std::set<subdomain_id_type> & subdomains_relative_to);
 
+  /**
+   * Helper method for _find_id_maps() on distributed meshes: one
+   * round of communication fetching, from their owners, the new ids
+   * of the boundary sides in \p sides_requested and the boundary
+   * nodes in \p nodes_requested, so each processor only ends up with
+   * the map entries it can use rather than the global maps.
+   */
+  void _pull_id_maps (const std::map<processor_id_type, std::vector<std::pair<dof_id_type, unsigned char>>> & sides_requested,
+                      std::map<std::pair<dof_id_type, unsigned char>, dof_id_type> * side_id_map,
+                      std::map<processor_id_type, std::vector<dof_id_type>> & nodes_requested,
+                      std::map<dof_id_type, dof_id_type> * node_id_map);
+
   /**
    * A pointer to the Mesh this boundary info pertains to.
    */
@@ -973,6 +1011,17 @@ private:
                 std::pair<unsigned short int, boundary_id_type>>
   _boundary_side_id;
 
+  /**
+   * The set of elements with any entries in _boundary_side_id, so
+   * that the side loops of assembly can skip the sideset map search
+   * for the (usually vast majority of) elements with no boundary
+   * sides.  Rebuilt by regenerate_id_sets(), and only trusted while
+   * _elems_with_boundary_sides_valid is true.
+   */
+  std::unordered_set<const Elem *> _elems_with_boundary_sides;
+
+  bool _elems_with_boundary_sides_valid;
+
   /*
    * Whether or not children elements are associated with any boundary
    * It is false by default. The flag will be turned on if `add_side`
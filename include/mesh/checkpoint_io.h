@@ -29,7 +29,10 @@
 #include "libmesh/parallel_object.h"
 
 // C++ includes
+#include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace libMesh
@@ -47,6 +50,19 @@ class CheckpointIO;
  */
 std::unique_ptr<CheckpointIO> split_mesh(MeshBase & mesh, processor_id_type nsplits);
 
+/**
+ * refine_split_mesh takes a mesh already split into \p ncurrent pieces, e.g. by split_mesh(),
+ * and subdivides each piece into nsplits/ncurrent pieces, which must be a whole number.
+ * Piece p becomes pieces [p*nsplits/ncurrent, (p+1)*nsplits/ncurrent).  Splits for several
+ * piece counts which divide each other can then be computed as one hierarchy, partitioning
+ * only one piece's elements at a time rather than the whole mesh.  This requires the mesh
+ * partitioner to support Partitioner::partition_range().  It returns a CheckpointIO object
+ * as split_mesh() does.
+ */
+std::unique_ptr<CheckpointIO> refine_split_mesh(MeshBase & mesh,
+                                                processor_id_type ncurrent,
+                                                processor_id_type nsplits);
+
 /**
  * The CheckpointIO class can be used to write simplified restart
  * files that can be used to restart simulations that have
@@ -99,6 +115,13 @@ public:
    * running on several processors, input_name should simply be the name of the mesh split
    * directory without the "-split[n]" suffix.  The number of splits will be determined
    * automatically by the number of processes being used for the mesh at the time of reading.
+   *
+   * To restart from a split written for a different number of processors, set
+   * current_n_processors() to that number before reading.  On a distributed mesh each
+   * processor then reads only its own contiguous block of the split files and takes
+   * ownership of everything in them, so no processor ever holds more than its share of the
+   * mesh.  If there are fewer split files than processors some processors start out empty,
+   * and the mesh should be repartitioned, as prepare_for_use() does by default.
    */
   virtual void read (const std::string & input_name) override;
 
@@ -152,6 +175,18 @@ public:
   bool   parallel() const { return _parallel; }
   bool & parallel()       { return _parallel; }
 
+  /**
+   * Get/Set the flag indicating if split files should be written as
+   * raw, fixed-layout arrays in native byte order, which \p read()
+   * can memory map rather than decode value by value.  The header
+   * file is still written with Xdr; readers detect the raw format
+   * from the header version string, so this flag only matters when
+   * writing.  Raw files are not portable between machines with
+   * different byte orders or \p Real types.
+   */
+  bool   raw_binary() const { return _raw_binary; }
+  bool & raw_binary()       { return _raw_binary; }
+
   /**
    * Get/Set the version string.
    */
@@ -239,6 +274,16 @@ private:
    */
   void write_bc_names (Xdr & io, const BoundaryInfo & info, bool is_sideset) const;
 
+  /**
+   * Write one raw binary split file containing the given elements,
+   * nodes, and boundary conditions.
+   */
+  void write_raw_subfile (const std::string & file_name,
+                          const std::set<const Elem *, CompareElemIdsByLevel> & elements,
+                          const connected_node_set_type & nodeset,
+                          const std::vector<std::tuple<dof_id_type, unsigned short int, boundary_id_type>> & bc_triples,
+                          const std::vector<std::tuple<dof_id_type, boundary_id_type>> & bc_tuples) const;
+
 
   //---------------------------------------------------------------------------
   // Read Implementation
@@ -279,6 +324,11 @@ private:
   template <typename file_id_type>
   void read_remote_elem (Xdr & io, bool expect_all_remote);
 
+  /**
+   * Read one raw binary split file, memory mapping it if possible.
+   */
+  void read_raw_subfile (const std::string & file_name, bool expect_all_remote);
+
   /**
    * Read the nodal locations for a parallel, distributed mesh
    */
@@ -325,6 +375,13 @@ private:
 
   processor_id_type select_split_config(const std::string & input_name, header_id_type & data_size);
 
+  /**
+   * \returns The processor which should own an object that belonged
+   * to processor \p file_pid when the files being read were written.
+   * Each split file belongs to the processor which reads it.
+   */
+  processor_id_type reading_processor_id (largest_id_type file_pid) const;
+
   bool _binary;
   bool _parallel;
   std::string _version;
@@ -334,6 +391,19 @@ private:
 
   // The largest processor id to write
   processor_id_type _my_n_processors;
+
+  // Whether split files are raw binary arrays rather than Xdr
+  bool _raw_binary;
+
+  // The number of split files in the checkpoint being read
+  processor_id_type _input_n_processors;
+
+  // When one processor reads several split files: whether we're
+  // counting, and how many of those files each element appeared in
+  // and how many marked each element side as remote
+  bool _count_remote_sides;
+  std::unordered_map<dof_id_type, unsigned int> _elem_file_counts;
+  std::map<std::pair<dof_id_type, unsigned short>, unsigned int> _remote_side_counts;
 };
 
 
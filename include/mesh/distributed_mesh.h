@@ -397,6 +397,10 @@ public:
   DECLARE_ELEM_ITERATORS(flagged_pid_, unsigned char rflag LIBMESH_COMMA processor_id_type pid, rflag LIBMESH_COMMA pid)
 #endif
 
+  virtual dof_id_type elem_ptr_block (dof_id_type first_id,
+                                      Elem ** block,
+                                      unsigned int & n) const override final;
+
   DECLARE_NODE_ITERATORS(,,)
   DECLARE_NODE_ITERATORS(active_,,)
   DECLARE_NODE_ITERATORS(local_,,)
@@ -416,6 +420,9 @@ protected:
    */
   virtual void move_nodes_and_elements(MeshBase && other_mesh) override;
 
+  virtual void permute_ids (const std::unordered_map<dof_id_type, dof_id_type> & new_elem_ids,
+                            const std::unordered_map<dof_id_type, dof_id_type> & new_node_ids) override;
+
   /**
    * The vertices (spatial coordinates) of the mesh.
    */
@@ -37,6 +37,7 @@ class EquationSystems;
 class ExodusII_IO_Helper;
 class MeshBase;
 class System;
+template <typename T> class NumericVector;
 
 /**
  * The \p ExodusII_IO class implements reading meshes in the
@@ -89,6 +90,9 @@ public:
    * ExodusII format. This is the method to use for reading in meshes generated
    * by cubit.  Works in 2D for \p TRIs, \p TRI6s, \p QUAD s, and \p QUAD9s.
    * Works in 3D for \p TET4s, \p TET10s, \p HEX8s, and \p HEX27s.
+   *
+   * See set_distributed_read() for reading only part of the file on
+   * each processor.
    */
   virtual void read (const std::string & name) override;
 
@@ -180,6 +184,35 @@ public:
                                std::string exodus_var_name,
                                unsigned int timestep=1);
 
+  /**
+   * Copies several nodal variables at several time steps at once: the
+   * values of \p exodus_var_names[v] at \p timesteps[t] are copied
+   * into the coefficients of \p system_var_names[v] in \p
+   * vectors[t], which must be vectors of \p system, e.g. its \p
+   * solution.  The file is read once per time step for all the
+   * variables, the node ids are mapped once, and each vector gets a
+   * single \p insert() of its sorted local dof indices.
+   *
+   * The vectors are closed afterwards, and \p system is updated.
+   */
+  void copy_nodal_solution(System & system,
+                           const std::vector<std::string> & system_var_names,
+                           const std::vector<std::string> & exodus_var_names,
+                           const std::vector<unsigned int> & timesteps,
+                           const std::vector<NumericVector<Number> *> & vectors);
+
+  /**
+   * Copies several elemental variables at several time steps at
+   * once, as the above \p copy_nodal_solution() does for nodal ones.
+   * Each system variable must be \p CONSTANT \p MONOMIAL (or a \p
+   * CONSTANT \p MONOMIAL_VEC component).
+   */
+  void copy_elemental_solution(System & system,
+                               const std::vector<std::string> & system_var_names,
+                               const std::vector<std::string> & exodus_var_names,
+                               const std::vector<unsigned int> & timesteps,
+                               const std::vector<NumericVector<Number> *> & vectors);
+
   /**
    * Copy global variables into scalar variables of a System object.
    */
@@ -583,6 +616,59 @@ public:
    */
   void set_discontinuous_bex(bool disc_bex);
 
+  /**
+   * Set to true (false is the default) to have read() into a
+   * DistributedMesh read only a contiguous slice of about 1/P of
+   * the file's elements, and the nodes they use, on each of the P
+   * processors, rather than the whole mesh on every processor.  The
+   * next prepare_for_use() then repartitions and redistributes the
+   * mesh, so peak memory per processor scales with the mesh size
+   * over P.
+   *
+   * read() must then be called on every processor at once, so use
+   * ExodusII_IO directly rather than through MeshBase::read().
+   * Reads into a ReplicatedMesh ignore this setting.
+   *
+   * Distributed reads require ExodusII v8 or later, and do not
+   * support Bezier Extraction meshes, edge blocks, or extra integer
+   * variables.
+   */
+  void set_distributed_read(bool distributed_read);
+
+  /**
+   * Set to true (false is the default) to have write() and
+   * write_timestep() write a single file collectively from every
+   * processor, using parallel netCDF-4 I/O, rather than serializing
+   * the mesh and solution onto processor 0.  Each processor then
+   * writes only its own nodes, active elements and nodal solution
+   * values.
+   *
+   * This requires an ExodusII library built against a netCDF with
+   * parallel I/O support.  Appending, added sides, discontinuous
+   * output, edge blocks, elemsets and elemental variables are not
+   * supported in this mode.
+   */
+  void set_parallel_write(bool parallel_write);
+
+  /**
+   * Set to true (false is the default) to have write_timestep(),
+   * write_element_data() and write_global_data() return once their
+   * data has been gathered and copied, leaving a background thread
+   * to write it to the file.  At most \p max_queued_timesteps time
+   * steps may wait to be written before write_timestep() blocks.
+   *
+   * Call flush_async_output() before reading the file, or any other
+   * Exodus file, since the Exodus library is not thread-safe.
+   */
+  void set_async_output(bool async_output,
+                        unsigned int max_queued_timesteps = 2);
+
+  /**
+   * Blocks until all asynchronous output has been written, rethrowing
+   * any error which occurred while writing.
+   */
+  void flush_async_output();
+
   /**
    * This function factors out a bunch of code which is common to the
    * write_nodal_data() and write_nodal_data_discontinuous() functions
@@ -592,6 +678,53 @@ public:
                                bool continuous=true);
 
 private:
+  /**
+   * The implementation of the batched copy_nodal_solution() and
+   * copy_elemental_solution().
+   */
+  void copy_solutions (System & system,
+                       bool nodal,
+                       const std::vector<std::string> & system_var_names,
+                       const std::vector<std::string> & exodus_var_names,
+                       const std::vector<unsigned int> & timesteps,
+                       const std::vector<NumericVector<Number> *> & vectors);
+
+  /**
+   * The implementation of read() for set_distributed_read(true).
+   */
+  void read_distributed (const std::string & name);
+
+  /**
+   * Writes the nodal data of a time step by packing local solution
+   * values directly, without building a serialized solution vector,
+   * if an earlier write_timestep() call with the same arguments made
+   * a usable plan for doing so.
+   *
+   * \returns \p true if the data was written.
+   */
+  bool write_nodal_data_planned (const std::string & fname,
+                                 const EquationSystems & es,
+                                 const std::set<std::string> * system_names);
+
+  /**
+   * Makes the plan used by write_nodal_data_planned(), after the
+   * first time step has been written.  The plan is only usable if
+   * every nodal output variable is a scalar Lagrange variable with a
+   * single dof on each node of the elements it is active on, so that
+   * its nodal values are simply its solution values.
+   */
+  void plan_nodal_data (const std::string & fname,
+                        const EquationSystems & es,
+                        const std::set<std::string> * system_names);
+
+  /**
+   * The implementation of write_timestep()'s nodal data output for
+   * set_parallel_write(true).
+   */
+  void write_nodal_data_parallel (const std::string & fname,
+                                  const EquationSystems & es,
+                                  const std::set<std::string> * system_names);
+
   /**
    * Only attempt to instantiate an ExodusII helper class
    * if the Exodus API is defined.  This class will have no
@@ -616,6 +749,12 @@ private:
    * rather than created from scratch when writing.
    */
   bool _append;
+
+  /**
+   * The output plan of write_timestep(), made after its first call.
+   */
+  struct NodalOutputPlan;
+  std::unique_ptr<NodalOutputPlan> _nodal_output_plan;
 #endif
 
   /**
@@ -657,6 +796,18 @@ private:
    * for every Bezier Extraction element.
    */
   bool _disc_bex;
+
+  /**
+   * Set to true (false is the default) to read only part of the mesh
+   * on each processor.
+   */
+  bool _distributed_read;
+
+  /**
+   * Set to true (false is the default) to write from every processor
+   * at once.
+   */
+  bool _parallel_write;
 };
 
 
@@ -30,8 +30,14 @@
 #include "libmesh/exodus_header_info.h"
 
 // C++ includes
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include <map>
 
@@ -168,6 +174,17 @@ public:
    */
   void read_node_num_map();
 
+  /**
+   * Reads the coordinates and \p node_num_map entries of only the
+   * nodes with (0-based) file indices \p node_indices, which must be
+   * sorted and unique.  Afterward \p x, \p y, \p z and \p
+   * node_num_map have one entry per index, in the same order.
+   * Nearby indices are read together in contiguous chunks.
+   *
+   * Requires ExodusII v8 or later.
+   */
+  void read_partial_nodes(const std::vector<int> & node_indices);
+
   /**
    * Reads the optional \p bex_cv_blocks from the \p ExodusII mesh
    * file.
@@ -224,6 +241,17 @@ public:
    */
   void read_elem_in_block(int block);
 
+  /**
+   * Reads the header of block \p block, and the connectivity of only
+   * the \p n_elem elements starting at (0-based) index \p first_elem
+   * within that block.  \p num_elem_this_blk is still set to the size
+   * of the whole block, so passing \p n_elem == 0 just reads the
+   * block header.  Bezier Extraction blocks are not supported.
+   *
+   * Requires ExodusII v8 or later.
+   */
+  void read_partial_elem_in_block(int block, int first_elem, int n_elem);
+
   /**
    * Read in edge blocks, storing information in the BoundaryInfo object.
    */
@@ -235,6 +263,15 @@ public:
    */
   void read_elem_num_map();
 
+  /**
+   * Reads only the \p n_elem entries of the \p elem_num_map starting
+   * at (0-based) element index \p first_elem, so that afterward
+   * elem_num_map[i] is the entry for element first_elem+i.
+   *
+   * Requires ExodusII v8 or later.
+   */
+  void read_partial_elem_num_map(int first_elem, int n_elem);
+
   /**
    * Reads information about all of the sidesets in the \p ExodusII
    * mesh file.
@@ -305,11 +342,45 @@ public:
                                  int time_step,
                                  std::map<dof_id_type, Real> & elem_var_value_map);
 
+  /**
+   * Reads the nodal values of each of the variables \p nodal_var_names
+   * at the specified time into \p values, one vector per variable.
+   * Each vector is in file order, i.e. the value of node
+   * node_num_map[i]-1 is at index i.  The variable names are only
+   * read from the file once.
+   */
+  void read_nodal_var_values(const std::vector<std::string> & nodal_var_names,
+                             int time_step,
+                             std::vector<std::vector<Real>> & values);
+
+  /**
+   * Reads the elemental values of each of the variables \p
+   * elemental_var_names at the specified timestep into \p values, one
+   * vector per variable.  Each vector is in file order, i.e. the
+   * value of element elem_num_map[i]-1 is at index i, and holds NaN
+   * for elements of blocks on which the variable is not active.
+   */
+  void read_elemental_var_values(const std::vector<std::string> & elemental_var_names,
+                                 int time_step,
+                                 std::vector<std::vector<Real>> & values);
+
   /**
    * Opens an \p ExodusII mesh file named \p filename for writing.
    */
   virtual void create(std::string filename);
 
+  /**
+   * Collectively creates an \p ExodusII mesh file named \p filename
+   * on every processor, for parallel netCDF-4 output via
+   * write_parallel_mesh() and write_partial_nodal_values().  After
+   * this call the writing functions which are otherwise only run on
+   * processor 0 are run on every processor.
+   *
+   * This requires an ExodusII library built against a netCDF with
+   * parallel I/O support.
+   */
+  void create_parallel(std::string filename);
+
   /**
    * Initializes the Exodus file.
    */
@@ -347,6 +418,21 @@ public:
    */
   virtual void write_nodesets(const MeshBase & mesh);
 
+  /**
+   * Writes the header, nodal coordinates, element blocks, sidesets
+   * and nodesets of a possibly-distributed \p mesh to a file opened
+   * with create_parallel().  Every processor writes only its own
+   * nodes and active elements, so the mesh is never serialized.
+   *
+   * Each processor's nodes, and each processor's elements within a
+   * block, get contiguous ranges in the file, ordered by processor
+   * id.  Afterwards node_num_map holds only the (1-based) ids of our
+   * own nodes, in the order expected by write_partial_nodal_values().
+   *
+   * Added sides, edge blocks and elemsets are not supported.
+   */
+  void write_parallel_mesh(const MeshBase & mesh);
+
   /**
    * Sets up the nodal variables
    */
@@ -507,6 +593,13 @@ public:
    */
   void write_nodal_values(int var_id, const std::vector<Real> & values, int timestep);
 
+  /**
+   * Writes this processor's part of a nodal variable, to a file
+   * written by write_parallel_mesh().  \p values must have one entry
+   * for each entry of node_num_map.
+   */
+  void write_partial_nodal_values(int var_id, const std::vector<Real> & values, int timestep);
+
   /**
    * Writes the vector of information records.
    */
@@ -545,6 +638,30 @@ public:
    */
   void set_hdf5_writing(bool write_hdf5);
 
+  /**
+   * Set to true (false is the default) to have nodal, element and
+   * global variable values, and time values, copied into a staging
+   * buffer and written to the file by a background thread, so the
+   * caller can go on computing while the data makes its way to disk.
+   *
+   * Each write_timestep() call ends one snapshot.  At most
+   * \p max_queued_timesteps snapshots may be waiting or in progress
+   * at once; after that, write_timestep() blocks until the oldest
+   * one is done.
+   *
+   * Exodus and netCDF are not thread-safe, so other functions which
+   * touch the file wait for the queue to drain first, and no other
+   * Exodus file should be accessed while writes are pending.
+   */
+  void set_async_writes(bool async_writes,
+                        unsigned int max_queued_timesteps = 2);
+
+  /**
+   * Blocks until every asynchronous write has reached the file, and
+   * rethrows the first error, if any, which occurred while writing.
+   */
+  void flush_async_writes();
+
   /**
    * Sets the value of _write_as_dimension.
    *
@@ -936,6 +1053,40 @@ protected:
    */
   void write_var_names(ExodusVarType type, const std::vector<std::string> & names);
 
+  /**
+   * A write of a copy of some data, deferred in async mode.
+   */
+  struct DeferredWrite
+  {
+    std::vector<Real> data;
+    std::function<void(const std::vector<Real> &)> write;
+  };
+
+  /**
+   * Calls \p write on \p data right away or, in async mode, queues
+   * a copy of \p data to be written by the writer thread.
+   */
+  void queue_write(const std::vector<Real> & data,
+                   std::function<void(const std::vector<Real> &)> write);
+
+  /**
+   * Hands the writes queued since the last call over to the writer
+   * thread, starting that thread if necessary.
+   */
+  void submit_async_writes();
+
+  /**
+   * Flushes any asynchronous writes, logging rather than throwing
+   * errors, and stops the writer thread.  For use when closing the
+   * file.
+   */
+  void finish_async_writes() noexcept;
+
+  /**
+   * The loop run by the writer thread.
+   */
+  void async_write_loop();
+
   // If true, whenever there is an I/O operation, only perform if if we are on processor 0.
   bool _run_only_on_proc0;
 
@@ -963,6 +1114,34 @@ protected:
   // Set once the elem num map has been read
   int _end_elem_id;
 
+  // If true, values are written by a background thread
+  bool _async_writes;
+
+  // The most snapshots which may be queued for the writer thread
+  unsigned int _max_queued_timesteps;
+
+  // Writes queued since the last write_timestep()
+  std::vector<DeferredWrite> _pending_writes;
+
+  // Snapshots waiting for, or being written by, the writer thread.
+  // The writer only pops a snapshot once it is done with it.
+  std::deque<std::vector<DeferredWrite>> _write_queue;
+
+  // Tells the writer thread to exit once the queue is empty
+  bool _stop_writer;
+
+  // The first error thrown on the writer thread
+  std::exception_ptr _writer_error;
+
+  // Protects the queue and the flags above shared with the writer
+  std::mutex _writer_mutex;
+  std::condition_variable _writer_cv;
+  std::thread _writer_thread;
+
+  // The (0-based) index in the file of our first node, when each
+  // processor writes its own nodes.
+  int _first_parallel_node;
+
   // Use this for num_dim when writing the Exodus file.  If non-zero, supersedes
   // any value set in _use_mesh_dimension_instead_of_spatial_dimension.
   unsigned _write_as_dimension;
@@ -0,0 +1,216 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_FILTERED_ELEM_RANGE_H
+#define LIBMESH_FILTERED_ELEM_RANGE_H
+
+// Local includes
+#include "libmesh/id_types.h"
+#include "libmesh/enum_elem_type.h"
+
+// C++ includes
+#include <array>
+#include <type_traits>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+
+/**
+ * Predicates for use with \p FilteredElemRange.  Unlike the
+ * predicates in \p Predicates, these are plain value types whose
+ * operator() is known at compile time, so an element loop over a
+ * \p FilteredElemRange inlines the test instead of calling through a
+ * virtual \p PredBase.
+ */
+namespace ElemFilters
+{
+
+struct All
+{
+  template <typename ElemPtr>
+  bool operator() (const ElemPtr) const { return true; }
+};
+
+struct Active
+{
+  template <typename ElemPtr>
+  bool operator() (const ElemPtr elem) const { return elem->active(); }
+};
+
+struct Pid
+{
+  processor_id_type pid;
+
+  template <typename ElemPtr>
+  bool operator() (const ElemPtr elem) const { return elem->processor_id() == pid; }
+};
+
+struct ActivePid
+{
+  processor_id_type pid;
+
+  template <typename ElemPtr>
+  bool operator() (const ElemPtr elem) const
+  { return elem->processor_id() == pid && elem->active(); }
+};
+
+struct ActiveSubdomain
+{
+  subdomain_id_type sid;
+
+  template <typename ElemPtr>
+  bool operator() (const ElemPtr elem) const
+  { return elem->subdomain_id() == sid && elem->active(); }
+};
+
+struct ActivePidSubdomain
+{
+  processor_id_type pid;
+  subdomain_id_type sid;
+
+  template <typename ElemPtr>
+  bool operator() (const ElemPtr elem) const
+  { return elem->processor_id() == pid && elem->subdomain_id() == sid &&
+      elem->active(); }
+};
+
+struct Type
+{
+  ElemType type;
+
+  template <typename ElemPtr>
+  bool operator() (const ElemPtr elem) const { return elem->type() == type; }
+};
+
+struct ActiveType
+{
+  ElemType type;
+
+  template <typename ElemPtr>
+  bool operator() (const ElemPtr elem) const
+  { return elem->type() == type && elem->active(); }
+};
+
+} // namespace ElemFilters
+
+
+
+/**
+ * A range over the elements of a mesh which satisfy the predicate \p
+ * Pred, for use in range-for loops.
+ *
+ * Rather than stepping a type-erased storage iterator one element at
+ * a time, the iterator asks the mesh for a block of element pointers
+ * with a single virtual call to \p MeshBase::elem_ptr_block(), then
+ * walks the block with an inlined test of \p Pred.  \p MeshT is \p
+ * MeshBase or \p const \p MeshBase, and determines whether the loop
+ * sees \p Elem * or \p const \p Elem *.
+ *
+ * Blocks are requested by element id, so as with the usual element
+ * iterators, elements may be modified in the loop body but should
+ * not be added or deleted.
+ */
+template <typename MeshT, typename Pred>
+class FilteredElemRange
+{
+public:
+  typedef typename std::conditional<std::is_const<MeshT>::value,
+                                    const Elem *, Elem *>::type value_type;
+
+  /**
+   * The number of element pointers fetched from the mesh at a time.
+   */
+  static constexpr unsigned int block_size = 64;
+
+  FilteredElemRange (MeshT & mesh, Pred pred) :
+    _mesh(mesh), _pred(pred) {}
+
+  /**
+   * Marks the end of a \p FilteredElemRange.
+   */
+  struct sentinel {};
+
+  class iterator
+  {
+  public:
+    iterator (MeshT & mesh, Pred pred) :
+      _mesh(&mesh), _pred(pred), _pos(0), _n(0), _next_id(0)
+    {
+      this->fill();
+      this->skip();
+    }
+
+    value_type operator* () const { return _block[_pos]; }
+
+    iterator & operator++ ()
+    {
+      ++_pos;
+      this->skip();
+      return *this;
+    }
+
+    bool operator!= (const sentinel &) const { return _n != 0; }
+
+    bool operator== (const sentinel &) const { return _n == 0; }
+
+  private:
+    // Moves _pos to the next element satisfying _pred, fetching new
+    // blocks from the mesh as needed.  Leaves _n == 0 at the end.
+    void skip ()
+    {
+      while (_n)
+        {
+          for (; _pos != _n; ++_pos)
+            if (_pred(static_cast<value_type>(_block[_pos])))
+              return;
+
+          this->fill();
+        }
+    }
+
+    void fill ()
+    {
+      _pos = 0;
+      _n = block_size;
+      _next_id = _mesh->elem_ptr_block(_next_id, _block.data(), _n);
+    }
+
+    MeshT * _mesh;
+    Pred _pred;
+    std::array<Elem *, block_size> _block;
+    unsigned int _pos, _n;
+    dof_id_type _next_id;
+  };
+
+  iterator begin () const { return iterator(_mesh, _pred); }
+
+  sentinel end () const { return sentinel(); }
+
+private:
+  MeshT & _mesh;
+  Pred _pred;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FILTERED_ELEM_RANGE_H
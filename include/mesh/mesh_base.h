@@ -22,18 +22,24 @@
 
 // Local Includes
 #include "libmesh/dof_object.h" // for invalid_processor_id
+#include "libmesh/filtered_elem_range.h"
 #include "libmesh/int_range.h"
 #include "libmesh/libmesh_common.h"
 #include "libmesh/multi_predicates.h"
 #include "libmesh/point_locator_base.h"
+#include "libmesh/point.h"
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/parallel_object.h"
 #include "libmesh/simple_range.h"
 
 // C++ Includes
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace libMesh
 {
@@ -51,6 +57,9 @@ enum ElemMappingType : unsigned char;
 template <class MT>
 class MeshInput;
 
+template <typename iterator_type, typename object_type>
+class StoredRange;
+
 
 /**
  * This is the \p MeshBase class. This class provides all the data necessary
@@ -188,11 +197,108 @@ public:
   bool is_prepared () const
   { return _is_prepared; }
 
+  /**
+   * The invariants which prepare_for_use() establishes, each of
+   * which may or may not still hold after a mesh modification.
+   */
+  struct Preparation
+  {
+    /**
+     * Nodes and elements are renumbered (if renumbering is allowed),
+     * orphaned nodes are removed, and parallel id counts are synched.
+     */
+    bool has_synched_id_counts = false;
+
+    /**
+     * Element neighbor links are set (if find_neighbors() is allowed).
+     */
+    bool has_neighbor_ptrs = false;
+
+    /**
+     * Element dimensions, subdomain ids and elemset codes are cached.
+     */
+    bool has_cached_elem_data = false;
+
+    /**
+     * Lower-dimensional elements have their interior_parent() set.
+     */
+    bool has_interior_parent_ptrs = false;
+
+    /**
+     * Ghosting functors have been reinitialized for the current mesh.
+     */
+    bool has_reinit_ghosting_functors = false;
+
+    /**
+     * The mesh is partitioned (unless partitioning is skipped).
+     */
+    bool is_partitioned = false;
+
+    /**
+     * Remote elements have been deleted (if that is allowed).
+     */
+    bool has_removed_remote_elements = false;
+
+    /**
+     * BoundaryInfo id sets and names have been regenerated.
+     */
+    bool has_boundary_id_sets = false;
+
+    /**
+     * \returns A Preparation with every invariant set.
+     */
+    static Preparation all ();
+
+    /**
+     * \returns \p true if every invariant is set.
+     */
+    explicit operator bool () const;
+
+    /**
+     * Clears every invariant which isn't also set in \p other.
+     */
+    Preparation & operator&= (const Preparation & other);
+  };
+
   /**
    * Tells this we have done some operation where we should no longer consider ourself prepared
    */
   void set_isnt_prepared()
-  { _is_prepared = false; }
+  { this->set_isnt_prepared(Preparation()); }
+
+  /**
+   * Tells this we have done some operation which may have broken
+   * any invariant of a prepared mesh except those set in \p
+   * preserved, so that the next prepare_for_use() need only redo
+   * the work for the others.  For example, after only changing
+   * element subdomain ids, a mesh generator might call
+   *
+   * \code
+   * MeshBase::Preparation preserved = MeshBase::Preparation::all();
+   * preserved.has_cached_elem_data = false;
+   * mesh.set_isnt_prepared(preserved);
+   * \endcode
+   *
+   * Repeated calls accumulate: only invariants preserved by every
+   * call since the last prepare_for_use() are kept.
+   *
+   * \note If the mesh is modified and prepare_for_use() called again
+   * without any call to set_isnt_prepared() in between, nothing is
+   * assumed to be preserved and the full preparation is redone.
+   */
+  void set_isnt_prepared (const Preparation & preserved)
+  {
+    _is_prepared = false;
+    _preparation &= preserved;
+    this->clear_stored_ranges();
+  }
+
+  /**
+   * \returns Which of the invariants of a prepared mesh are
+   * currently assumed to hold.
+   */
+  const Preparation & preparation () const
+  { return _preparation; }
 
   /**
    * \returns \p true if all elements and nodes of the mesh
@@ -1122,6 +1228,10 @@ public:
    * If this is a distributed mesh, local copies of remote elements
    * will be deleted here - to keep those elements replicated during
    * preparation, set allow_remote_element_removal(false).
+   *
+   * Steps whose results were declared preserved by
+   * set_isnt_prepared(preserved) since the last preparation are
+   * skipped.
    */
   void prepare_for_use (const bool skip_renumber_nodes_and_elements, const bool skip_find_neighbors);
   void prepare_for_use (const bool skip_renumber_nodes_and_elements);
@@ -1169,6 +1279,32 @@ public:
   void allow_renumbering(bool allow) { _skip_renumber_nodes_and_elements = !allow; }
   bool allow_renumbering() const { return !_skip_renumber_nodes_and_elements; }
 
+  /**
+   * If true is passed in then, whenever this mesh is renumbered while
+   * being prepared for use, the ids of the elements and nodes owned
+   * by each processor are also reordered along a space-filling curve
+   * by \p renumber_by_locality().  Has no effect unless renumbering
+   * is allowed.
+   */
+  void locality_renumbering(bool renumber) { _locality_renumbering = renumber; }
+  bool locality_renumbering() const { return _locality_renumbering; }
+
+  /**
+   * Permutes the ids of the elements and nodes owned by each
+   * processor, and their places in the mesh storage, so that they
+   * follow a Hilbert curve (a Morton curve if libMesh was built
+   * without libHilbert) through the objects' positions.  Each
+   * processor keeps the set of ids it owned before; only their
+   * assignment to objects changes.  Spatially adjacent objects then
+   * tend to be adjacent in memory, and degree of freedom numberings
+   * built from the element order inherit the locality.
+   *
+   * Ghost objects on a distributed mesh get their new ids from their
+   * owners.  Any systems on this mesh must be reinitialized
+   * afterward.
+   */
+  void renumber_by_locality ();
+
   /**
    * If \p false is passed then this mesh will no longer work to find element
    * neighbors when being prepared for use
@@ -1344,6 +1480,26 @@ public:
    */
   void print_info (std::ostream & os=libMesh::out, const unsigned int verbosity = 0, const bool global = true) const;
 
+  /**
+   * \returns Estimates of the memory, in bytes, used on this processor
+   * by each part of the mesh: element and node objects, the links
+   * between them, DofObject index buffers, and boundary conditions.
+   * Elements owned by other processors are counted separately.
+   */
+  std::vector<std::pair<std::string, std::size_t>> local_memory_usage () const;
+
+  /**
+   * \returns A table of the estimates from local_memory_usage(), with
+   * their minimum and maximum per processor and their totals.  This
+   * must be called on all processors at once.
+   */
+  std::string get_memory_info () const;
+
+  /**
+   * Prints the table from get_memory_info().
+   */
+  void print_memory_info (std::ostream & os=libMesh::out) const;
+
   /**
    * Equivalent to calling print_info() above, but now you can write:
    * Mesh mesh;
@@ -1461,6 +1617,128 @@ public:
    */
   void clear_point_locator ();
 
+  /**
+   * Builds a contiguous, structure-of-arrays copy of the coordinates
+   * of every node on this processor, so that geometric passes over
+   * the mesh can stream through coordinates rather than chasing
+   * pointers to individual Node objects.  The cache is rebuilt by
+   * \p prepare_for_use() and dropped by \p clear(), but it is not
+   * updated when nodes are otherwise moved, added or removed; call
+   * this again or \p clear_node_coordinates_cache() after doing so.
+   */
+  void cache_node_coordinates ();
+
+  /**
+   * Releases any cache built by \p cache_node_coordinates().
+   */
+  void clear_node_coordinates_cache ();
+
+  /**
+   * \returns \p true if a node coordinate cache has been built.
+   */
+  bool has_node_coordinates_cache () const
+  { return _node_coordinates_cache_size != DofObject::invalid_id; }
+
+  /**
+   * \returns A pointer to the cached coordinate \p component of each
+   * node, indexed by node id, from a cache built by \p
+   * cache_node_coordinates().  The array has \p
+   * node_coordinates_cache_size() entries; those for ids with no node
+   * on this processor are NaN.
+   */
+  const Real * cached_node_coordinates (unsigned int component) const;
+
+  /**
+   * \returns The number of entries in each cached coordinate array.
+   */
+  dof_id_type node_coordinates_cache_size () const
+  { return _node_coordinates_cache_size; }
+
+  /**
+   * Computes and stores the volume(), true_centroid(), hmin() and
+   * hmax() of every element on this processor, using threads if
+   * they are available, so that codes which query these repeatedly
+   * (error estimators, CFL conditions) don't recompute them each
+   * time.  Like the node coordinate cache, this cache is rebuilt by
+   * \p prepare_for_use() and dropped by \p clear(), but it is not
+   * updated when nodes are otherwise moved; call this again or \p
+   * clear_elem_geometry_cache() after doing so.
+   */
+  void cache_elem_geometry ();
+
+  /**
+   * Releases any cache built by \p cache_elem_geometry().
+   */
+  void clear_elem_geometry_cache ();
+
+  /**
+   * \returns \p true if an element geometry cache has been built.
+   */
+  bool has_elem_geometry_cache () const
+  { return !_elem_geometry_cache.empty(); }
+
+  /**
+   * \returns \p elem.volume(), from the element geometry cache if
+   * there is one.
+   */
+  Real elem_volume (const Elem & elem) const;
+
+  /**
+   * \returns \p elem.true_centroid(), from the element geometry cache
+   * if there is one.
+   */
+  Point elem_true_centroid (const Elem & elem) const;
+
+  /**
+   * \returns \p elem.hmin(), from the element geometry cache if there
+   * is one.
+   */
+  Real elem_hmin (const Elem & elem) const;
+
+  /**
+   * \returns \p elem.hmax(), from the element geometry cache if there
+   * is one.
+   */
+  Real elem_hmax (const Elem & elem) const;
+
+  /**
+   * \returns A \p ConstElemRange over the active local elements,
+   * built on first use and then kept until the mesh changes, so that
+   * repeated threaded loops (assembly, projections, error estimation)
+   * don't repack the element pointers each time.  Adding or deleting
+   * elements or nodes, repartitioning, \p set_isnt_prepared(), \p
+   * prepare_for_use() and \p clear() all drop the stored ranges.
+   *
+   * \note The ranges are built lazily and without locking, so these
+   * should be called from serial code; the range returned can then be
+   * used by \p Threads::parallel_for() and friends.
+   */
+  const StoredRange<const_element_iterator, const Elem *> &
+  active_local_element_stored_range () const;
+
+  /**
+   * \returns A stored \p ConstElemRange over the active local
+   * elements in subdomain \p sid, kept like \p
+   * active_local_element_stored_range().
+   */
+  const StoredRange<const_element_iterator, const Elem *> &
+  active_local_subdomain_element_stored_range (subdomain_id_type sid) const;
+
+  /**
+   * \returns A stored \p ConstNodeRange over the local nodes, kept
+   * like \p active_local_element_stored_range().
+   */
+  const StoredRange<const_node_iterator, const Node *> &
+  local_node_stored_range () const;
+
+  /**
+   * Releases any ranges built by the \p *_stored_range() methods.
+   * Code which changes element activity, subdomain ids or processor
+   * ids directly, without calling \p set_isnt_prepared(), should
+   * call this itself.
+   */
+  void clear_stored_ranges () const;
+
   /**
    * In the point locator, do we count lower dimensional elements
    * when we refine point locator regions? This is relevant in
@@ -1620,6 +1898,86 @@ public:
   ABSTRACT_ELEM_ITERATORS(flagged_pid_,unsigned char rflag LIBMESH_COMMA processor_id_type pid)
 #endif
 
+  /**
+   * Copies up to \p n pointers to the elements with ids of at least
+   * \p first_id into \p block, in increasing id order, skipping ids
+   * with no element on this processor.  On return \p n holds the
+   * number of pointers copied; zero means there are no more elements.
+   *
+   * \returns The id at which the following block should start.
+   *
+   * This is the storage hook behind \p FilteredElemRange, which
+   * costs one virtual call per block rather than several per element.
+   */
+  virtual dof_id_type elem_ptr_block (dof_id_type first_id,
+                                      Elem ** block,
+                                      unsigned int & n) const = 0;
+
+  /**
+   * \returns A range over the elements satisfying \p pred, one of the
+   * \p ElemFilters predicates or any other copyable functor taking an
+   * element pointer.  The predicate is inlined into the loop rather
+   * than dispatched through \p variant_filter_iterator, which makes
+   * these ranges preferable for simple serial loops in hot code.
+   */
+  template <typename Pred>
+  FilteredElemRange<MeshBase, Pred> filtered_element_ptr_range (Pred pred)
+  { return {*this, pred}; }
+
+  template <typename Pred>
+  FilteredElemRange<const MeshBase, Pred> filtered_element_ptr_range (Pred pred) const
+  { return {*this, pred}; }
+
+  /**
+   * Non-virtual versions of the most commonly used filtered element
+   * ranges, equivalent to the corresponding \p *_element_ptr_range()
+   * but built on \p filtered_element_ptr_range().
+   */
+  FilteredElemRange<MeshBase, ElemFilters::All> fast_element_ptr_range ()
+  { return this->filtered_element_ptr_range(ElemFilters::All()); }
+  FilteredElemRange<const MeshBase, ElemFilters::All> fast_element_ptr_range () const
+  { return this->filtered_element_ptr_range(ElemFilters::All()); }
+
+  FilteredElemRange<MeshBase, ElemFilters::Active> fast_active_element_ptr_range ()
+  { return this->filtered_element_ptr_range(ElemFilters::Active()); }
+  FilteredElemRange<const MeshBase, ElemFilters::Active> fast_active_element_ptr_range () const
+  { return this->filtered_element_ptr_range(ElemFilters::Active()); }
+
+  FilteredElemRange<MeshBase, ElemFilters::Pid> fast_local_element_ptr_range ()
+  { return this->filtered_element_ptr_range(ElemFilters::Pid{this->processor_id()}); }
+  FilteredElemRange<const MeshBase, ElemFilters::Pid> fast_local_element_ptr_range () const
+  { return this->filtered_element_ptr_range(ElemFilters::Pid{this->processor_id()}); }
+
+  FilteredElemRange<MeshBase, ElemFilters::ActivePid> fast_active_local_element_ptr_range ()
+  { return this->filtered_element_ptr_range(ElemFilters::ActivePid{this->processor_id()}); }
+  FilteredElemRange<const MeshBase, ElemFilters::ActivePid> fast_active_local_element_ptr_range () const
+  { return this->filtered_element_ptr_range(ElemFilters::ActivePid{this->processor_id()}); }
+
+  FilteredElemRange<MeshBase, ElemFilters::ActivePid> fast_active_pid_element_ptr_range (processor_id_type pid)
+  { return this->filtered_element_ptr_range(ElemFilters::ActivePid{pid}); }
+  FilteredElemRange<const MeshBase, ElemFilters::ActivePid> fast_active_pid_element_ptr_range (processor_id_type pid) const
+  { return this->filtered_element_ptr_range(ElemFilters::ActivePid{pid}); }
+
+  FilteredElemRange<MeshBase, ElemFilters::ActiveSubdomain> fast_active_subdomain_element_ptr_range (subdomain_id_type sid)
+  { return this->filtered_element_ptr_range(ElemFilters::ActiveSubdomain{sid}); }
+  FilteredElemRange<const MeshBase, ElemFilters::ActiveSubdomain> fast_active_subdomain_element_ptr_range (subdomain_id_type sid) const
+  { return this->filtered_element_ptr_range(ElemFilters::ActiveSubdomain{sid}); }
+
+  FilteredElemRange<MeshBase, ElemFilters::ActivePidSubdomain> fast_active_local_subdomain_element_ptr_range (subdomain_id_type sid)
+  { return this->filtered_element_ptr_range(ElemFilters::ActivePidSubdomain{this->processor_id(), sid}); }
+  FilteredElemRange<const MeshBase, ElemFilters::ActivePidSubdomain> fast_active_local_subdomain_element_ptr_range (subdomain_id_type sid) const
+  { return this->filtered_element_ptr_range(ElemFilters::ActivePidSubdomain{this->processor_id(), sid}); }
+
+  FilteredElemRange<MeshBase, ElemFilters::Type> fast_type_element_ptr_range (ElemType type)
+  { return this->filtered_element_ptr_range(ElemFilters::Type{type}); }
+  FilteredElemRange<const MeshBase, ElemFilters::Type> fast_type_element_ptr_range (ElemType type) const
+  { return this->filtered_element_ptr_range(ElemFilters::Type{type}); }
+
+  FilteredElemRange<MeshBase, ElemFilters::ActiveType> fast_active_type_element_ptr_range (ElemType type)
+  { return this->filtered_element_ptr_range(ElemFilters::ActiveType{type}); }
+  FilteredElemRange<const MeshBase, ElemFilters::ActiveType> fast_active_type_element_ptr_range (ElemType type) const
+  { return this->filtered_element_ptr_range(ElemFilters::ActiveType{type}); }
+
   /*
    * node_iterator accessors
    *
@@ -1742,6 +2100,15 @@ protected:
    */
   virtual bool subclass_locally_equals (const MeshBase & other_mesh) const = 0;
 
+  /**
+   * Gives each element and node whose id appears in \p new_elem_ids or
+   * \p new_node_ids the id it maps to, moving it to the matching place
+   * in storage.  The mapped ids must be a permutation of the original
+   * ones.  Helper function for \p renumber_by_locality().
+   */
+  virtual void permute_ids (const std::unordered_map<dof_id_type, dof_id_type> & new_elem_ids,
+                            const std::unordered_map<dof_id_type, dof_id_type> & new_node_ids) = 0;
+
   /**
    * Tests for equality of all elements and nodes in the mesh.  Helper
    * function for subclass_equals() in unstructured mesh subclasses.
@@ -1784,6 +2151,13 @@ protected:
    */
   bool _is_prepared;
 
+  /**
+   * The invariants of a prepared mesh which have been declared
+   * preserved by every set_isnt_prepared() call since the last
+   * prepare_for_use().
+   */
+  Preparation _preparation;
+
   /**
    * A \p PointLocator class for this mesh.
    * This will not actually be built unless needed. Further, since we want
@@ -1793,6 +2167,56 @@ protected:
    */
   mutable std::unique_ptr<PointLocatorBase> _point_locator;
 
+  /**
+   * Node coordinates from \p cache_node_coordinates(), stored one
+   * component after another, each indexed by node id.
+   */
+  std::vector<Real> _node_coordinates_cache;
+
+  /**
+   * The number of node ids in \p _node_coordinates_cache, or
+   * invalid_id if there is no cache.
+   */
+  dof_id_type _node_coordinates_cache_size;
+
+  /**
+   * Geometric quantities cached by \p cache_elem_geometry().
+   */
+  struct ElemGeometry
+  {
+    Real volume;
+    Real hmin;
+    Real hmax;
+    Point true_centroid;
+  };
+
+  /**
+   * The element geometry cache, indexed by element id.  Entries for
+   * ids with no element on this processor have a NaN volume.
+   */
+  std::vector<ElemGeometry> _elem_geometry_cache;
+
+  /**
+   * The ranges built by the \p *_stored_range() methods, if any.
+   */
+  struct StoredRanges;
+  mutable std::unique_ptr<StoredRanges> _stored_ranges;
+
+  /**
+   * A hash of the ids and Hilbert keys of the nodes and elements on
+   * this processor as of the last
+   * MeshCommunication::assign_global_indices(), which lets it skip
+   * renumbering a mesh when none of them have changed.  Empty if
+   * there is none.
+   */
+  std::vector<std::uint64_t> _global_index_signature;
+
+  /**
+   * \returns The cached geometry of \p elem, or nullptr if it has
+   * not been cached.
+   */
+  const ElemGeometry * cached_elem_geometry (const Elem & elem) const;
+
   /**
    * Do we count lower dimensional elements in point locator refinement?
    * This is relevant in tree-based point locators, for example.
@@ -1832,6 +2256,12 @@ protected:
    */
   bool _skip_renumber_nodes_and_elements;
 
+  /**
+   * If this is true then renumbering also orders each processor's
+   * ids along a space-filling curve.
+   */
+  bool _locality_renumbering;
+
   /**
    * If this is \p true then we will skip \p find_neighbors in \p prepare_for_use
    */
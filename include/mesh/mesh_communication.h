@@ -26,6 +26,7 @@
 #include "libmesh/mesh_tools.h"
 
 // C++ Includes
+#include <functional>
 #include <unordered_map>
 
 namespace libMesh
@@ -34,6 +35,8 @@ namespace libMesh
 // Forward declarations
 class MeshBase;
 class DistributedMesh;
+class Elem;
+class Node;
 
 // This is for backwards compatibility, but if your code relies on
 // forward declarations in our headers then fix it.
@@ -135,6 +138,32 @@ public:
   void allgather (MeshBase & mesh) const
   { MeshCommunication::gather(DofObject::invalid_processor_id, mesh); }
 
+  /**
+   * A bounded-memory alternative to gathering a distributed mesh for
+   * output.  On processor \p root_id, calls \p node_action for every
+   * node and then \p elem_action for every element (or every active
+   * element, if \p active_only) of \p mesh, each in increasing id
+   * order.  Objects are sent to the root in chunks covering at most
+   * \p chunk_size ids, so no processor ever holds more than one chunk
+   * of copies at a time and the mesh itself is never serialized.
+   *
+   * The objects passed to the actions are temporary copies, valid
+   * only during the call.  Nodes have their id, processor id and
+   * location.  Elements have their id, type, subdomain id and
+   * processor id, and nodes carrying the correct ids (but not
+   * locations); they have no parent, neighbor or boundary
+   * information.
+   *
+   * Since this method is collective it must be called by all
+   * processors.
+   */
+  void stream_to_root (const processor_id_type root_id,
+                       const MeshBase & mesh,
+                       const std::function<void (const Node &)> & node_action,
+                       const std::function<void (const Elem &)> & elem_action,
+                       bool active_only = false,
+                       dof_id_type chunk_size = 100000) const;
+
   /**
    * This method takes an input \p DistributedMesh which may be
    * distributed among all the processors.  Each processor
@@ -27,6 +27,7 @@
 #include "libmesh/tensor_value.h"
 #include "libmesh/tree_base.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/id_types.h"
 
 // C++ includes
 #include <cstddef>
@@ -276,6 +277,81 @@ public:
                 std::vector<Tensor> & output,
                 const std::set<subdomain_id_type> * subdomain_ids);
 
+  /**
+   * Computes values at each of the coordinates \p points and for
+   * time \p time, optionally restricting the points to the
+   * MeshFunction subdomain_ids.  On return \p output[i] holds what
+   * operator() would give for \p points[i].
+   *
+   * The points are located together, grouped by element so that
+   * each element's map is inverted and its shape functions are
+   * evaluated once per group, and the groups are shared among
+   * threads.
+   */
+  void evaluate_points (const std::vector<Point> & points,
+                        const Real time,
+                        std::vector<DenseVector<Number>> & output);
+
+  /**
+   * Same as above, but restricting the points to the passed
+   * subdomain_ids, which parameter overrides the internal
+   * subdomain_ids.
+   */
+  void evaluate_points (const std::vector<Point> & points,
+                        const Real time,
+                        std::vector<DenseVector<Number>> & output,
+                        const std::set<subdomain_id_type> * subdomain_ids);
+
+  /**
+   * Evaluates variable \p i at each of \p points via
+   * evaluate_points(), so the points are located and interpolated to
+   * in groups rather than one at a time.
+   */
+  virtual void component_at_points (unsigned int i,
+                                    const std::vector<Point> & points,
+                                    Real time,
+                                    std::vector<Number> & values) override;
+
+  /**
+   * Locates all of \p points at once, optionally restricted to the
+   * MeshFunction subdomain_ids, and stores the dof indices and shape
+   * function values needed to interpolate there.  Afterwards
+   * evaluate_precomputed_points() can evaluate at all the points
+   * without searching the mesh or computing shape functions again.
+   *
+   * The stored data stays valid as the values in the vector change,
+   * but must be recomputed if the mesh or its dof numbering does.
+   */
+  void precompute_points (const std::vector<Point> & points);
+
+  /**
+   * Same as above, but restricting the points to the passed
+   * subdomain_ids, which parameter overrides the internal
+   * subdomain_ids.
+   */
+  void precompute_points (const std::vector<Point> & points,
+                          const std::set<subdomain_id_type> * subdomain_ids);
+
+  /**
+   * Evaluates every variable at every point passed to the last call
+   * of precompute_points(), using the current values of the vector.
+   * On return \p values[i*n_vars + v] holds variable \p v at point
+   * \p i, where \p n_vars is the number of variables the
+   * MeshFunction was built with.
+   */
+  void evaluate_precomputed_points (std::vector<Number> & values) const;
+
+  /**
+   * \returns The number of points stored by precompute_points().
+   */
+  std::size_t n_precomputed_points () const
+  { return _plan_outside.size(); }
+
+  /**
+   * Discards the data stored by precompute_points().
+   */
+  void clear_precomputed_points ();
+
   /**
    * \returns The current \p PointLocator object, for use elsewhere.
    *
@@ -344,6 +420,14 @@ protected:
   const Elem * find_element(const Point & p,
                             const std::set<subdomain_id_type> * subdomain_ids = nullptr) const;
 
+  /**
+   * \returns \p element if we can evaluate on it, or otherwise a
+   * local element sharing the point \p p with it, or nullptr if
+   * there is none.
+   */
+  const Elem * find_local_element(const Point & p,
+                                  const Elem * element) const;
+
   /**
    * \returns All elements that are close to a point \p p.
    *
@@ -406,6 +490,19 @@ protected:
    * See \p enable_out_of_mesh_mode() for more details.
    */
   DenseVector<Number> _out_of_mesh_value;
+
+  /**
+   * The data stored by precompute_points().  For point \p i and
+   * variable index \p v the value is the sum of the vector values
+   * at _plan_dofs[j] weighted by _plan_weights[j], for \p j from
+   * _plan_offsets[k] to _plan_offsets[k+1], with \p k = i*n_vars+v.
+   * Points which weren't found in the mesh are marked in
+   * _plan_outside and get the out-of-mesh value instead.
+   */
+  std::vector<std::size_t> _plan_offsets;
+  std::vector<numeric_index_type> _plan_dofs;
+  std::vector<Number> _plan_weights;
+  std::vector<bool> _plan_outside;
 };
 
 
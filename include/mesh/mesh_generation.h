@@ -76,6 +76,33 @@ void build_cube (UnstructuredMesh & mesh,
                  const ElemType type=INVALID_ELEM,
                  const bool gauss_lobatto_grid=false);
 
+/**
+ * Builds the same \f$ nx \times ny \times nz \f$ hex cube as \p
+ * build_cube(), but on a distributed mesh each processor only
+ * creates its own slab of elements, stacked in z, plus one layer of
+ * ghost elements on either side of it.  Node and element ids (and
+ * unique ids) are computed arithmetically, exactly as \p build_cube()
+ * would assign them, so no communication is needed to generate the
+ * mesh and no processor ever holds the whole mesh.
+ *
+ * The resulting slab partitioning is kept; \p mesh is not
+ * repartitioned by the \p prepare_for_use() call at the end.  Only
+ * \p HEX8 and \p HEX27 elements are supported.  If \p mesh is
+ * replicated this simply calls \p build_cube().
+ *
+ * \note The one ghost layer suffices for the default (point
+ * neighbor) ghosting functors.  Meshes which need wider ghosting
+ * should be built with \p build_cube().
+ */
+void build_distributed_cube (UnstructuredMesh & mesh,
+                             const unsigned int nx,
+                             const unsigned int ny,
+                             const unsigned int nz,
+                             const Real xmin=0., const Real xmax=1.,
+                             const Real ymin=0., const Real ymax=1.,
+                             const Real zmin=0., const Real zmax=1.,
+                             const ElemType type=INVALID_ELEM);
+
 /**
  * A specialized \p build_cube() for 0D meshes.  The resulting
  * mesh is a single NodeElem suitable for ODE tests
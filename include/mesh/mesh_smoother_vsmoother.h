@@ -375,6 +375,28 @@ private:
               const std::vector<Real> & afun,
               std::vector<Real> & Gloc);
 
+  /**
+   * Calls \p localP() with f=1 on each cell not excluded by \p
+   * mcells, in parallel, storing the functional value, minimum
+   * Jacobian and minimum quality of cell i in \p fun[i], \p Vmin[i]
+   * and \p qmin[i] respectively.
+   */
+  void localP_cells(Array2D<Real> & R,
+                    const std::vector<int> & mask,
+                    const Array2D<int> & cells,
+                    const std::vector<int> & mcells,
+                    Real epsilon,
+                    Real w,
+                    const Array3D<Real> & H,
+                    int me,
+                    Real vol,
+                    int adp,
+                    const std::vector<Real> & afun,
+                    Array2D<Real> & G,
+                    std::vector<Real> & fun,
+                    std::vector<Real> & Vmin,
+                    std::vector<Real> & qmin);
+
   Real avertex(const std::vector<Real> & afun,
                std::vector<Real> & G,
                const Array2D<Real> & R,
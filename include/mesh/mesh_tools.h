@@ -40,6 +40,7 @@ namespace libMesh
 class Sphere;
 class Elem;
 enum ElemType : int;
+enum ElemQuality : int;
 
 /**
  * Utility functions for operations on a \p Mesh object.  Here is where
@@ -192,6 +193,42 @@ Sphere
 subdomain_bounding_sphere (const MeshBase & mesh,
                            const subdomain_id_type sid);
 
+/**
+ * Summary statistics of an element quality metric over the active
+ * elements of a mesh, as returned by compute_quality().
+ */
+struct QualityStatistics
+{
+  /**
+   * The number of active elements measured, on all processors.
+   */
+  dof_id_type n_elem = 0;
+
+  /**
+   * The minimum, maximum and mean quality over those elements.
+   */
+  Real min = 0;
+  Real max = 0;
+  Real mean = 0;
+
+  /**
+   * The number of elements in each of equally sized bins spanning
+   * [min, max].  If every element has the same quality then they are
+   * all counted in the first bin.
+   */
+  std::vector<dof_id_type> histogram;
+};
+
+/**
+ * Evaluates the quality metric \p q on every active local element,
+ * using threads if they are available, and combines the results
+ * across processors into global statistics and an \p n_bins bin
+ * histogram.  This must be called on all processors at once.
+ */
+QualityStatistics compute_quality (const MeshBase & mesh,
+                                   const ElemQuality q,
+                                   const unsigned int n_bins = 10);
+
 
 /**
  * Fills in a vector of all element types in the mesh.  Implemented
@@ -328,6 +365,38 @@ void find_nodal_neighbors(const MeshBase & mesh,
                           const std::unordered_map<dof_id_type, std::vector<const Elem *>> & nodes_to_elem_map,
                           std::vector<const Node *> & neighbors);
 
+/**
+ * \returns The permutation of \p points which visits them along a
+ * Morton (Z-order) space-filling curve through their bounding box,
+ * so that processing the points in that order keeps nearby points
+ * together.
+ */
+std::vector<std::size_t> locality_order(const std::vector<Point> & points);
+
+/**
+ * Reorders \p elems along a Morton (Z-order) space-filling curve
+ * through their vertex averages, so that elements which are close
+ * in space are also close in the vector.
+ *
+ * A StoredRange built on the sorted vector then splits into
+ * spatially compact chunks, so each thread works on elements which
+ * share nodes and degrees of freedom with one another rather than
+ * an arbitrary run of elements in storage order.
+ */
+void sort_elems_by_locality(std::vector<const Elem *> & elems);
+
+/**
+ * Stably reorders \p elems so that elements with the same type,
+ * p refinement level and subdomain id are contiguous, keeping the
+ * existing order within each group.
+ *
+ * Finite element objects which are reinitialized on every element
+ * of a group can then reuse shape function data which only depends
+ * on the element type and p level, rather than recomputing it each
+ * time a mixed mesh switches between element types.
+ */
+void sort_elems_by_type(std::vector<const Elem *> & elems);
+
 /**
  * Given a mesh hanging_nodes will be filled with an associative array keyed off the
  * global id of all the hanging nodes in the mesh.  It will hold an array of the
@@ -74,6 +74,17 @@ public:
    */
   virtual void read (const std::string & base_filename) override;
 
+  /**
+   * Set the number of files \p n_files which a mesh to be read was
+   * split into, when that differs from the number of processors
+   * reading it.  Each processor then reads a contiguous range of the
+   * files, and the elements it reads are assigned to it until the
+   * mesh is next repartitioned, e.g. by prepare_for_use().
+   *
+   * The default, 0, expects one file per processor.
+   */
+  void set_n_files (processor_id_type n_files);
+
   /**
    * This method implements writing a mesh to a specified file.
    */
@@ -209,6 +220,25 @@ public:
    */
   void set_hdf5_writing(bool write_hdf5);
 
+  /**
+   * Set to true (false is the default) to have write_timestep()
+   * return once each processor's data has been gathered and copied,
+   * leaving a background thread on each processor to write it.  At
+   * most \p max_queued_timesteps time steps may wait to be written
+   * before write_timestep() blocks.
+   *
+   * Call flush_async_output() before reading the files, or any other
+   * Exodus file, since the Exodus library is not thread-safe.
+   */
+  void set_async_output(bool async_output,
+                        unsigned int max_queued_timesteps = 2);
+
+  /**
+   * Blocks until all asynchronous output has been written, rethrowing
+   * any error which occurred while writing.
+   */
+  void flush_async_output();
+
 private:
 
   /*
@@ -219,6 +249,18 @@ private:
    */
   void assert_symmetric_cmaps();
 
+  /**
+   * Reads a mesh split into \p _n_files files, for a number of
+   * processors other than \p _n_files.
+   */
+  void read_repartitioned (const std::string & base_filename);
+
+  /**
+   * Code shared by the read methods: makes the locally read mesh
+   * parallel-consistent and gathers ghost elements.
+   */
+  void finish_parallel_read ();
+
 #if defined(LIBMESH_HAVE_EXODUS_API) && defined(LIBMESH_HAVE_NEMESIS_API)
   std::unique_ptr<Nemesis_IO_Helper> nemhelper;
 
@@ -240,6 +282,11 @@ private:
    */
   bool _append;
 
+  /**
+   * The number of files read() expects, or 0 for one per processor.
+   */
+  processor_id_type _n_files;
+
   /**
    * Helper function containing code shared between the two different
    * versions of write_nodal_data which take std::vector and
@@ -373,6 +373,15 @@ public:
    */
   std::string construct_nemesis_filename(std::string_view base_filename);
 
+  /**
+   * Given base_filename, foo.e, constructs the Nemesis filename
+   * foo.e.X.Y, where X=\p n_files and Y=\p file_id, for reading a
+   * mesh decomposed for a different number of processors.
+   */
+  std::string construct_nemesis_filename(std::string_view base_filename,
+                                         processor_id_type n_files,
+                                         processor_id_type file_id);
+
   /**
    * Member data
    */
@@ -0,0 +1,135 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_PVTU_IO_H
+#define LIBMESH_PVTU_IO_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/mesh_output.h"
+
+// C++ includes
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+template <typename T> class NumericVector;
+
+/**
+ * This class implements writing meshes, with optional nodal data, in
+ * the parallel XML VTK unstructured grid format, without depending
+ * on the VTK library.
+ *
+ * Each processor independently writes its active local elements, and
+ * the nodes they touch, to its own "<base>_<rank>.vtu" piece, with
+ * all array data in a single appended binary block.  Processor 0
+ * additionally writes the "<base>.pvtu" file which ParaView opens to
+ * read all the pieces.  The mesh is never serialized, and nodal data
+ * is only localized at the nodes each piece needs.
+ */
+class PVTUIO : public MeshOutput<MeshBase>
+{
+public:
+
+  /**
+   * Constructor.  Takes a reference to a constant mesh object.
+   * This constructor will only allow us to write the mesh.
+   */
+  explicit
+  PVTUIO (const MeshBase &);
+
+  /**
+   * This method implements writing a mesh to a specified ".pvtu"
+   * file, and its pieces.
+   */
+  virtual void write (const std::string &) override;
+
+  /**
+   * Bring in base class functionality for name resolution and to
+   * avoid warnings about hidden overloaded virtual functions.
+   */
+  using MeshOutput<MeshBase>::write_nodal_data;
+
+  /**
+   * This method implements writing a mesh with nodal data, given
+   * as a vector indexed by (node id * number of variables +
+   * variable number).
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const std::vector<Number> &,
+                                 const std::vector<std::string> &) override;
+
+  /**
+   * This method implements writing a mesh with nodal data from a
+   * parallel vector with the same indexing, localizing only the
+   * values at nodes in this processor's piece.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const NumericVector<Number> &,
+                                 const std::vector<std::string> &) override;
+
+  /**
+   * Set to true to write the appended data base64-encoded rather
+   * than as raw bytes.  Raw data is smaller and faster to write and
+   * read; base64 keeps the files valid XML.  Defaults to false.
+   */
+  bool & base64 () { return _base64; }
+
+private:
+
+  /**
+   * Writes this processor's piece, and the ".pvtu" file on
+   * processor 0.  \p values holds \p names.size() values for each
+   * of the piece's points, in the order given by \p piece_nodes.
+   */
+  void write_piece (const std::string & fname,
+                    const std::vector<dof_id_type> & piece_nodes,
+                    const std::vector<std::string> & names,
+                    const std::vector<Number> & values);
+
+  /**
+   * \returns The ids of the nodes touched by active local elements,
+   * in the order they will be numbered in this processor's piece.
+   */
+  std::vector<dof_id_type> piece_nodes () const;
+
+  /**
+   * Whether to write the appended data base64-encoded.
+   */
+  bool _base64;
+};
+
+
+
+// ------------------------------------------------------------
+// PVTUIO inline members
+inline
+PVTUIO::PVTUIO (const MeshBase & mesh_in) :
+  MeshOutput<MeshBase> (mesh_in, /* is_parallel_format = */ true),
+  _base64(false)
+{
+}
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_PVTU_IO_H
@@ -0,0 +1,220 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_SHARED_MESH_VIEW_H
+#define LIBMESH_SHARED_MESH_VIEW_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/parallel_object.h"
+#include "libmesh/point.h"
+#include "libmesh/enum_elem_type.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * A compact, read-only copy of the coordinates, connectivity,
+ * subdomain ids and boundary ids of a whole mesh, stored once per
+ * shared-memory node.
+ *
+ * When libMesh is built with an MPI-3 implementation, the copy lives
+ * in an MPI shared-memory window allocated by one rank on each node:
+ * it is filled on processor 0 and broadcast to the other nodes, and
+ * every rank then reads it in place.  Codes which need global mesh
+ * information on every rank (point searches, geometric queries,
+ * output of the whole mesh) can then run fully distributed meshes
+ * and use this view instead of a ReplicatedMesh on each rank.
+ * Without MPI-3 each rank simply keeps its own copy.
+ *
+ * Data is indexed by node and element id, up to the \p max_node_id()
+ * and \p max_elem_id() of the mesh; ids with no node or element are
+ * reported by \p has_node() and \p has_elem().
+ */
+class SharedMeshView : public ParallelObject
+{
+public:
+  /**
+   * Builds the view of \p mesh.  This is a collective operation on
+   * the mesh communicator, and the whole mesh must be present on
+   * processor 0, e.g. a ReplicatedMesh, or a DistributedMesh after
+   * \p gather_to_zero() or \p allgather().
+   */
+  explicit SharedMeshView (const MeshBase & mesh);
+
+  /**
+   * Frees the shared-memory window.  Collective on every processor.
+   */
+  ~SharedMeshView ();
+
+  /**
+   * This class owns an MPI window and may not be copied.
+   */
+  SharedMeshView (const SharedMeshView &) = delete;
+  SharedMeshView & operator= (const SharedMeshView &) = delete;
+
+  /**
+   * \returns One more than the largest node id in the mesh.
+   */
+  dof_id_type max_node_id () const { return _max_node_id; }
+
+  /**
+   * \returns One more than the largest element id in the mesh.
+   */
+  dof_id_type max_elem_id () const { return _max_elem_id; }
+
+  /**
+   * \returns \p true if the mesh had a node with id \p id.
+   */
+  bool has_node (dof_id_type id) const;
+
+  /**
+   * \returns \p true if the mesh had an element with id \p id.
+   */
+  bool has_elem (dof_id_type id) const;
+
+  /**
+   * \returns The position of the node with id \p id.
+   */
+  Point point (dof_id_type id) const;
+
+  /**
+   * \returns The type of the element with id \p id.
+   */
+  ElemType elem_type (dof_id_type id) const;
+
+  /**
+   * \returns The subdomain id of the element with id \p id.
+   */
+  subdomain_id_type subdomain_id (dof_id_type id) const;
+
+  /**
+   * \returns Whether the element with id \p id was active.
+   */
+  bool active (dof_id_type id) const;
+
+  /**
+   * \returns The number of nodes of the element with id \p id.
+   */
+  unsigned int n_elem_nodes (dof_id_type id) const;
+
+  /**
+   * \returns A pointer to the \p n_elem_nodes(id) node ids of the
+   * element with id \p id, in the element's local node order.
+   */
+  const dof_id_type * elem_node_ids (dof_id_type id) const;
+
+  /**
+   * Fills \p ids with the boundary ids of side \p side of the element
+   * with id \p elem_id, as \p BoundaryInfo::boundary_ids() returned
+   * them.
+   */
+  void boundary_ids (dof_id_type elem_id,
+                     unsigned short int side,
+                     std::vector<boundary_id_type> & ids) const;
+
+  /**
+   * Fills \p ids with the boundary ids of the node with id \p
+   * node_id.
+   */
+  void node_boundary_ids (dof_id_type node_id,
+                          std::vector<boundary_id_type> & ids) const;
+
+  /**
+   * \returns \p true if the data lives in a shared-memory window
+   * rather than in memory private to this rank.
+   */
+  bool is_node_shared () const { return _window_allocated; }
+
+  /**
+   * \returns The size in bytes of the data, which is stored once per
+   * shared-memory node if \p is_node_shared().
+   */
+  std::size_t n_bytes () const { return _n_bytes; }
+
+private:
+  /**
+   * The sizes of each array, broadcast from processor 0.
+   */
+  struct Sizes
+  {
+    dof_id_type max_node_id = 0;
+    dof_id_type max_elem_id = 0;
+    std::size_t n_connectivity = 0;
+    std::size_t n_side_bcs = 0;
+    std::size_t n_node_bcs = 0;
+  };
+
+  /**
+   * Points the array pointers below into the buffer at \p base, and
+   * \returns the total size of the buffer in bytes.
+   */
+  std::size_t layout (char * base, const Sizes & sizes);
+
+  /**
+   * Copies the data of \p mesh into the arrays.  Only called on
+   * processor 0.
+   */
+  void fill (const MeshBase & mesh);
+
+  dof_id_type _max_node_id;
+  dof_id_type _max_elem_id;
+  std::size_t _n_bytes;
+
+  // Arrays within the buffer: coordinates (LIBMESH_DIM per node, NaN
+  // for missing nodes); element types, subdomains, activity and
+  // connectivity offsets and node ids; and offsets into arrays of
+  // (side, boundary id) pairs per element and boundary ids per node
+  Real * _coords;
+  unsigned char * _elem_types;
+  unsigned char * _elem_active;
+  subdomain_id_type * _elem_subdomains;
+  std::size_t * _connectivity_offsets;
+  dof_id_type * _connectivity;
+  std::size_t * _side_bc_offsets;
+  unsigned short int * _side_bc_sides;
+  boundary_id_type * _side_bc_ids;
+  std::size_t * _node_bc_offsets;
+  boundary_id_type * _node_bc_ids;
+
+  /**
+   * Backing store when no shared-memory window is used.
+   */
+  std::vector<char> _private_buffer;
+
+  bool _window_allocated;
+
+#ifdef LIBMESH_HAVE_MPI
+  MPI_Win _window;
+  MPI_Comm _node_comm;
+#endif
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SHARED_MESH_VIEW_H
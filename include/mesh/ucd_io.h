@@ -108,6 +108,14 @@ private:
    */
   void write_implementation (std::ostream & out_stream);
 
+  /**
+   * Writes a distributed mesh without serializing it: nodes and
+   * elements are streamed to processor 0 in bounded chunks and
+   * written as they arrive.  \p out_stream is only non-null on
+   * processor 0, but this must be called on every processor.
+   */
+  void write_distributed (std::ostream * out_stream);
+
   /**
    * Write UCD format header
    */
@@ -111,6 +111,13 @@ public:
 
   /**
    * Report whether we should write parallel files.
+   *
+   * When this is \p true, the file is binary and libMesh was built
+   * with MPI, the connectivity and node sections are written
+   * collectively with MPI-IO: each processor encodes and writes its
+   * own elements and its own contiguous range of node ids
+   * concurrently, rather than shipping them to processor 0.  The
+   * resulting file is identical to a serialized one.
    */
   bool write_parallel() const;
 
@@ -212,6 +219,11 @@ public:
 
 private:
 
+  /**
+   * Helper for writing sections of a binary file collectively with
+   * MPI-IO; only usable when libMesh is built with MPI.
+   */
+  class CollectiveWriter;
 
   //---------------------------------------------------------------------------
   // Write Implementation
@@ -221,10 +233,13 @@ private:
   void write_serialized_subdomain_names(Xdr & io) const;
 
   /**
-   * Write the connectivity for a parallel, distributed mesh
+   * Write the connectivity for a parallel, distributed mesh.  If \p
+   * collective is given, each processor writes its own elements
+   * through it rather than sending them to processor 0.
    */
   void write_serialized_connectivity (Xdr & io, const dof_id_type n_elem,
-                                      const new_header_id_type n_elem_integers) const;
+                                      const new_header_id_type n_elem_integers,
+                                      CollectiveWriter * collective = nullptr) const;
 
   /**
    * Write the nodal locations for a parallel, distributed mesh
@@ -232,6 +247,15 @@ private:
   void write_serialized_nodes (Xdr & io, const dof_id_type n_nodes,
                                const new_header_id_type n_node_integers) const;
 
+  /**
+   * Write the nodal locations, unique ids and extra integers
+   * collectively: nodes are redistributed so that each processor
+   * holds a contiguous range of node ids, which it then writes.
+   */
+  void write_collective_nodes (Xdr & io, const dof_id_type n_nodes,
+                               const new_header_id_type n_node_integers,
+                               CollectiveWriter & collective) const;
+
   /**
    * Helper function used in write_serialized_side_bcs, write_serialized_edge_bcs, and
    * write_serialized_shellface_bcs.
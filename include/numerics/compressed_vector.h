@@ -0,0 +1,144 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_COMPRESSED_VECTOR_H
+#define LIBMESH_COMPRESSED_VECTOR_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class NumericVector;
+
+/**
+ * A compressed copy of the locally owned entries of a NumericVector,
+ * for data like solution histories which is kept around for a long
+ * time but only read back occasionally.
+ *
+ * With a zero \p tolerance the compression is lossless: each entry
+ * is XORed with the one before it and the zero high order bytes of
+ * the result are dropped, which pays off when neighbouring entries
+ * share their sign, exponent and leading digits; entries which don't
+ * compress are copied as they are.  With a positive
+ * \p tolerance each entry is rounded to the nearest multiple of
+ * 2*tolerance, so no retrieved entry is further than \p tolerance
+ * from the stored one, and the differences between neighbouring
+ * rounded entries are stored as variable length integers.  Smooth
+ * fields then take a byte or two per entry.  Entries too large to
+ * round that way, and non-finite entries, make store() fall back to
+ * lossless compression for the whole vector.
+ *
+ * Complex entries are compressed as pairs of real entries.
+ */
+template <typename T>
+class CompressedVector
+{
+public:
+  /**
+   * Creates an empty copy.
+   */
+  CompressedVector () = default;
+
+  /**
+   * Creates a compressed copy of the local entries of \p v.
+   */
+  explicit
+  CompressedVector (const NumericVector<T> & v,
+                    Real tolerance = 0);
+
+  /**
+   * Replaces the stored entries with the local entries of \p v,
+   * compressed to within \p tolerance.
+   */
+  void store (const NumericVector<T> & v,
+              Real tolerance = 0);
+
+  /**
+   * Sets the local entries of \p v, which must have been partitioned
+   * like the vector last passed to store(), to the stored values,
+   * and closes \p v.
+   */
+  void restore (NumericVector<T> & v) const;
+
+  /**
+   * \returns The number of stored entries.
+   */
+  std::size_t size () const { return _n_entries; }
+
+  /**
+   * \returns The number of bytes the compressed entries take.
+   */
+  std::size_t compressed_size () const { return _bytes.size(); }
+
+  /**
+   * \returns Whether the stored entries were rounded.
+   */
+  bool lossy () const { return _step > 0; }
+
+  /**
+   * Releases the stored entries.
+   */
+  void clear ();
+
+private:
+  /**
+   * The global index of the first stored entry.
+   */
+  numeric_index_type _first_local_index = 0;
+
+  /**
+   * The size of the vector the entries came from.
+   */
+  numeric_index_type _global_size = 0;
+
+  /**
+   * The number of stored entries.
+   */
+  std::size_t _n_entries = 0;
+
+  /**
+   * The spacing entries were rounded to, or zero if they were stored
+   * losslessly.
+   */
+  Real _step = 0;
+
+  /**
+   * Whether losslessly stored entries didn't compress, and were
+   * copied as they are instead.
+   */
+  bool _raw = false;
+
+  /**
+   * The compressed entries.
+   */
+  std::vector<unsigned char> _bytes;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_COMPRESSED_VECTOR_H
@@ -361,6 +361,30 @@ public:
   template <typename T2>
   void right_multiply_transpose (const DenseMatrix<T2> & A);
 
+  /**
+   * Adds \p factor times the product \f$ A^T B \f$ to this matrix,
+   * which must already be sized \p A.n() by \p B.n().  When BLAS
+   * support is available this is a single gemm call.
+   */
+  void add_transpose_product (const T factor,
+                              const DenseMatrix<T> & A,
+                              const DenseMatrix<T> & B);
+
+  /**
+   * Adds \f$ \sum_k w_k A_k^T B_k \f$ to this matrix, e.g. the
+   * \f$ B^T D B \f$ contributions of every quadrature point of an
+   * element, with \p A[qp] the strain-displacement matrix, \p B[qp]
+   * the product \f$ D B \f$ and \p weights the JxW values.
+   *
+   * The blocks are stacked into two tall matrices so that the whole
+   * sum is computed by one large add_transpose_product(), which is
+   * far more efficient than a small product per quadrature point for
+   * high order elements.
+   */
+  void add_transpose_products (const std::vector<Real> & weights,
+                               const std::vector<DenseMatrix<T>> & A,
+                               const std::vector<DenseMatrix<T>> & B);
+
   /**
    * \returns The \p (i,j) element of the transposed matrix.
    */
@@ -781,6 +805,15 @@ private:
    */
   template <typename T2>
   void _right_multiply_transpose (const DenseMatrix<T2> & A);
+
+  /**
+   * Computes this += factor * A^T * B using the BLAS gemm function.
+   * Used by add_transpose_product().
+   * [ Implementation in dense_matrix_blas_lapack.C ]
+   */
+  void _add_transpose_product_blas (const T factor,
+                                    const DenseMatrix<T> & A,
+                                    const DenseMatrix<T> & B);
 };
 
 
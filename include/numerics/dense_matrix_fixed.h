@@ -0,0 +1,176 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DENSE_MATRIX_FIXED_H
+#define LIBMESH_DENSE_MATRIX_FIXED_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix_base.h"
+#include "libmesh/dense_vector_fixed.h"
+
+// C++ includes
+#include <array>
+
+namespace libMesh
+{
+
+/**
+ * Defines a dense \f$ M \times N \f$ matrix whose dimensions are
+ * known at compile time, for element kernels whose number of degrees
+ * of freedom is fixed (e.g. an 8x8 Jacobian block for first order
+ * Lagrange on a Hex8).  The entries are stored inline, in row-major
+ * order like \p DenseMatrix, and loops over them have constant trip
+ * counts which compilers can unroll and vectorize.  All overridden
+ * virtual functions are documented in dense_matrix_base.h.
+ *
+ * A kernel can accumulate into one of these and then add the result
+ * into a \p DenseMatrix or \p DenseSubMatrix, e.g. of an \p
+ * FEMContext, with \p add_to() or \p DenseMatrixBase::add().
+ */
+template<typename T, unsigned int M, unsigned int N>
+class DenseMatrixFixed : public DenseMatrixBase<T>
+{
+public:
+
+  /**
+   * Constructor.  Creates a zero matrix.
+   */
+  DenseMatrixFixed() : DenseMatrixBase<T>(M, N) { this->zero(); }
+
+  /**
+   * The 5 special functions can be defaulted for this class, as it
+   * does not manage any memory itself.
+   */
+  DenseMatrixFixed (DenseMatrixFixed &&) = default;
+  DenseMatrixFixed (const DenseMatrixFixed &) = default;
+  DenseMatrixFixed & operator= (const DenseMatrixFixed &) = default;
+  DenseMatrixFixed & operator= (DenseMatrixFixed &&) = default;
+  virtual ~DenseMatrixFixed() = default;
+
+  virtual void zero() override final { _val.fill(T(0)); }
+
+  /**
+   * \returns The \p (i,j) element of the matrix.
+   */
+  const T & operator() (const unsigned int i,
+                        const unsigned int j) const
+  {
+    libmesh_assert_less (i, M);
+    libmesh_assert_less (j, N);
+    return _val[i*N + j];
+  }
+
+  /**
+   * \returns The \p (i,j) element of the matrix as a writable reference.
+   */
+  T & operator() (const unsigned int i,
+                  const unsigned int j)
+  {
+    libmesh_assert_less (i, M);
+    libmesh_assert_less (j, N);
+    return _val[i*N + j];
+  }
+
+  virtual T el(const unsigned int i,
+               const unsigned int j) const override final
+  { return (*this)(i,j); }
+
+  virtual T & el(const unsigned int i,
+                 const unsigned int j) override final
+  { return (*this)(i,j); }
+
+  /**
+   * Left multiplies by the square matrix \p M2; the dimensions of
+   * this matrix can't change, so \p M2 must be \p M x \p M.
+   */
+  virtual void left_multiply (const DenseMatrixBase<T> & M2) override final
+  {
+    libmesh_assert_equal_to (M2.m(), M);
+    libmesh_assert_equal_to (M2.n(), M);
+
+    const DenseMatrixFixed<T, M, N> M3(*this);
+    this->zero();
+    this->multiply(*this, M2, M3);
+  }
+
+  /**
+   * Right multiplies by the square matrix \p M3; the dimensions of
+   * this matrix can't change, so \p M3 must be \p N x \p N.
+   */
+  virtual void right_multiply (const DenseMatrixBase<T> & M3) override final
+  {
+    libmesh_assert_equal_to (M3.m(), N);
+    libmesh_assert_equal_to (M3.n(), N);
+
+    const DenseMatrixFixed<T, M, N> M2(*this);
+    this->zero();
+    this->multiply(*this, M2, M3);
+  }
+
+  /**
+   * Computes \p dest = (*this) * \p arg.
+   */
+  void vector_mult (DenseVectorFixed<T, M> & dest,
+                    const DenseVectorFixed<T, N> & arg) const
+  {
+    for (unsigned int i = 0; i != M; ++i)
+      {
+        T sum = 0;
+        for (unsigned int j = 0; j != N; ++j)
+          sum += _val[i*N + j] * arg(j);
+        dest(i) = sum;
+      }
+  }
+
+  /**
+   * Adds \p factor times this matrix to \p mat, which must be \p M x
+   * \p N.
+   */
+  template <typename T2 = T>
+  void add_to (DenseMatrixBase<T> & mat, const T2 factor = 1) const
+  {
+    libmesh_assert_equal_to (mat.m(), M);
+    libmesh_assert_equal_to (mat.n(), N);
+    for (unsigned int i = 0; i != M; ++i)
+      for (unsigned int j = 0; j != N; ++j)
+        mat.el(i,j) += factor * _val[i*N + j];
+  }
+
+  /**
+   * Access to the values array, in row-major order.
+   */
+  std::array<T, M*N> & get_values() { return _val; }
+
+  /**
+   * Access to the values array, in row-major order.
+   */
+  const std::array<T, M*N> & get_values() const { return _val; }
+
+private:
+
+  /**
+   * The actual data values, stored row-major.
+   */
+  std::array<T, M*N> _val;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DENSE_MATRIX_FIXED_H
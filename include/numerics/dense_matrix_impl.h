@@ -295,6 +295,86 @@ void DenseMatrix<T>::_right_multiply_transpose (const DenseMatrix<T2> & B)
 
 
 
+template<typename T>
+void DenseMatrix<T>::add_transpose_product (const T factor,
+                                            const DenseMatrix<T> & A,
+                                            const DenseMatrix<T> & B)
+{
+  libmesh_assert_equal_to (A.m(), B.m());
+  libmesh_assert_equal_to (this->m(), A.n());
+  libmesh_assert_equal_to (this->n(), B.n());
+  libmesh_assert(this != &A && this != &B);
+
+  // Short-circuit if there is nothing to add
+  if (A.m() == 0 || this->m() == 0 || this->n() == 0)
+    return;
+
+  if (this->use_blas_lapack)
+    {
+      this->_add_transpose_product_blas(factor, A, B);
+      return;
+    }
+
+  const unsigned int p_s = A.m();
+  const unsigned int m_s = this->m();
+  const unsigned int n_s = this->n();
+
+  // Loop over the shared rows outermost so that every inner loop
+  // walks contiguous rows of B and of this matrix.
+  for (unsigned int k=0; k<p_s; k++)
+    for (unsigned int i=0; i<m_s; i++)
+      {
+        const T a = factor * A(k,i);
+        if (a != 0.)
+          for (unsigned int j=0; j<n_s; j++)
+            (*this)(i,j) += a * B(k,j);
+      }
+}
+
+
+
+template<typename T>
+void DenseMatrix<T>::add_transpose_products (const std::vector<Real> & weights,
+                                             const std::vector<DenseMatrix<T>> & A,
+                                             const std::vector<DenseMatrix<T>> & B)
+{
+  libmesh_assert_equal_to (weights.size(), A.size());
+  libmesh_assert_equal_to (weights.size(), B.size());
+
+  unsigned int total_rows = 0;
+  for (auto k : index_range(A))
+    {
+      libmesh_assert_equal_to (A[k].m(), B[k].m());
+      libmesh_assert_equal_to (A[k].n(), this->m());
+      libmesh_assert_equal_to (B[k].n(), this->n());
+      total_rows += A[k].m();
+    }
+
+  // Stack the weighted A blocks and the B blocks; then
+  // sum_k w_k A_k^T B_k is a single product of the stacks.
+  DenseMatrix<T> A_stack(total_rows, this->m());
+  DenseMatrix<T> B_stack(total_rows, this->n());
+
+  unsigned int row = 0;
+  for (auto k : index_range(A))
+    {
+      const DenseMatrix<T> & A_k = A[k];
+      const DenseMatrix<T> & B_k = B[k];
+      for (unsigned int r=0; r != A_k.m(); ++r, ++row)
+        {
+          for (unsigned int i=0; i != A_k.n(); ++i)
+            A_stack(row,i) = weights[k] * A_k(r,i);
+          for (unsigned int j=0; j != B_k.n(); ++j)
+            B_stack(row,j) = B_k(r,j);
+        }
+    }
+
+  this->add_transpose_product(1., A_stack, B_stack);
+}
+
+
+
+
 template<typename T>
 void DenseMatrix<T>::vector_mult (DenseVector<T> & dest,
                                   const DenseVector<T> & arg) const
@@ -0,0 +1,138 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DENSE_VECTOR_FIXED_H
+#define LIBMESH_DENSE_VECTOR_FIXED_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_vector_base.h"
+
+// C++ includes
+#include <array>
+
+namespace libMesh
+{
+
+/**
+ * Defines a dense vector whose size \p N is known at compile time,
+ * for element kernels whose number of degrees of freedom is fixed
+ * (e.g. 8 for first order Lagrange on a Hex8).  The entries are
+ * stored inline rather than on the heap, and loops over them have
+ * constant trip counts which compilers can unroll and vectorize.
+ * All overridden virtual functions are documented in
+ * dense_vector_base.h.
+ *
+ * Results can be added into a \p DenseVector or \p DenseSubVector,
+ * e.g. of an \p FEMContext, through their base class interfaces.
+ */
+template<typename T, unsigned int N>
+class DenseVectorFixed : public DenseVectorBase<T>
+{
+public:
+
+  /**
+   * Constructor.  Creates a zero vector.
+   */
+  DenseVectorFixed() { this->zero(); }
+
+  /**
+   * The 5 special functions can be defaulted for this class, as it
+   * does not manage any memory itself.
+   */
+  DenseVectorFixed (DenseVectorFixed &&) = default;
+  DenseVectorFixed (const DenseVectorFixed &) = default;
+  DenseVectorFixed & operator= (const DenseVectorFixed &) = default;
+  DenseVectorFixed & operator= (DenseVectorFixed &&) = default;
+  virtual ~DenseVectorFixed() = default;
+
+  virtual unsigned int size() const override final { return N; }
+
+  virtual bool empty() const override final { return N == 0; }
+
+  virtual void zero() override final { _val.fill(T(0)); }
+
+  /**
+   * \returns Entry \p i of the vector as a const reference.
+   */
+  const T & operator() (const unsigned int i) const
+  {
+    libmesh_assert_less (i, N);
+    return _val[i];
+  }
+
+  /**
+   * \returns Entry \p i of the vector as a writable reference.
+   */
+  T & operator() (const unsigned int i)
+  {
+    libmesh_assert_less (i, N);
+    return _val[i];
+  }
+
+  virtual T el(const unsigned int i) const override final
+  { return (*this)(i); }
+
+  virtual T & el(const unsigned int i) override final
+  { return (*this)(i); }
+
+  /**
+   * Adds \p factor times this vector to \p vec, which must have size
+   * \p N.
+   */
+  template <typename T2 = T>
+  void add_to (DenseVectorBase<T> & vec, const T2 factor = 1) const
+  {
+    libmesh_assert_equal_to (vec.size(), N);
+    for (unsigned int i = 0; i != N; ++i)
+      vec.el(i) += factor * _val[i];
+  }
+
+  /**
+   * \returns The dot product of this vector with \p vec.
+   */
+  T dot (const DenseVectorFixed<T, N> & vec) const
+  {
+    T sum = 0;
+    for (unsigned int i = 0; i != N; ++i)
+      sum += _val[i] * vec._val[i];
+    return sum;
+  }
+
+  /**
+   * Access to the values array.
+   */
+  std::array<T, N> & get_values() { return _val; }
+
+  /**
+   * Access to the values array.
+   */
+  const std::array<T, N> & get_values() const { return _val; }
+
+private:
+
+  /**
+   * The actual data values.
+   */
+  std::array<T, N> _val;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DENSE_VECTOR_FIXED_H
@@ -108,6 +108,13 @@ public:
 
   virtual void clear() override;
 
+  /**
+   * Additions go to the underlying NumericVector, which is thread
+   * safe.
+   */
+  virtual bool supports_concurrent_disjoint_add() const override
+  { return true; }
+
   virtual void zero() override;
 
   virtual std::unique_ptr<SparseMatrix<T>> zero_clone () const override;
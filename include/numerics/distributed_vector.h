@@ -164,6 +164,8 @@ public:
 
   virtual T operator() (const numeric_index_type i) const override;
 
+  virtual typename NumericVector<T>::LocalArray get_local_array_read () const override;
+
   virtual NumericVector<T> & operator += (const NumericVector<T> & v) override;
 
   virtual NumericVector<T> & operator -= (const NumericVector<T> & v) override;
@@ -570,6 +572,25 @@ T DistributedVector<T>::operator() (const numeric_index_type i) const
 
 
 
+template <typename T>
+inline
+typename NumericVector<T>::LocalArray
+DistributedVector<T>::get_local_array_read () const
+{
+  libmesh_assert (this->initialized());
+  libmesh_assert_equal_to (_values.size(), _local_size);
+
+  typename NumericVector<T>::LocalArray array;
+  array.values = _values.data();
+  array.first = _first_local_index;
+  array.last = _last_local_index;
+  array.size = _values.size();
+
+  return array;
+}
+
+
+
 template <typename T>
 inline
 void DistributedVector<T>::set (const numeric_index_type i, const T value)
@@ -143,6 +143,10 @@ public:
 
   virtual void get_transpose (SparseMatrix<T> & dest) const override;
 
+  virtual void get_row(numeric_index_type i,
+                       std::vector<numeric_index_type> & indices,
+                       std::vector<T> & values) const override;
+
 private:
 
   /**
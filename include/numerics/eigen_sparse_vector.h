@@ -168,6 +168,8 @@ public:
 
   virtual T operator() (const numeric_index_type i) const override;
 
+  virtual typename NumericVector<T>::LocalArray get_local_array_read () const override;
+
   virtual NumericVector<T> & operator += (const NumericVector<T> & v) override;
 
   virtual NumericVector<T> & operator -= (const NumericVector<T> & v) override;
@@ -508,6 +510,24 @@ void EigenSparseVector<T>::add (const numeric_index_type i, const T value)
 
 
 
+template <typename T>
+inline
+typename NumericVector<T>::LocalArray
+EigenSparseVector<T>::get_local_array_read () const
+{
+  libmesh_assert (this->initialized());
+
+  typename NumericVector<T>::LocalArray array;
+  array.values = _vec.data();
+  array.first = 0;
+  array.last = this->size();
+  array.size = this->size();
+
+  return array;
+}
+
+
+
 template <typename T>
 inline
 T EigenSparseVector<T>::operator() (const numeric_index_type i) const
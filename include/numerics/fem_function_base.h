@@ -27,6 +27,7 @@
 
 // C++ includes
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -125,6 +126,20 @@ public:
                            unsigned int i,
                            const Point & p,
                            Real time=0.);
+
+  /**
+   * Evaluates the vector component \p i at each of \p points, at
+   * time \p time, into \p values, which is resized to match.
+   *
+   * The default implementation calls \p component() once per point.
+   * Subclasses which can evaluate many points at once more cheaply
+   * should override this.
+   */
+  virtual void component_at_points (const FEMContext &,
+                                    unsigned int i,
+                                    const std::vector<Point> & points,
+                                    Real time,
+                                    std::vector<Output> & values);
 };
 
 template <typename Output>
@@ -139,6 +154,19 @@ Output FEMFunctionBase<Output>::component (const FEMContext & context,
   return outvec(i);
 }
 
+template <typename Output>
+inline
+void FEMFunctionBase<Output>::component_at_points (const FEMContext & context,
+                                                   unsigned int i,
+                                                   const std::vector<Point> & points,
+                                                   Real time,
+                                                   std::vector<Output> & values)
+{
+  values.resize(points.size());
+  for (std::size_t p = 0; p != points.size(); ++p)
+    values[p] = this->component(context, i, points[p], time);
+}
+
 template <typename Output>
 inline
 void FEMFunctionBase<Output>::operator() (const FEMContext & context,
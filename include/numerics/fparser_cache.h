@@ -0,0 +1,210 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_FPARSER_CACHE_H
+#define LIBMESH_FPARSER_CACHE_H
+
+#include "libmesh/libmesh_config.h"
+
+#ifdef LIBMESH_HAVE_FPARSER
+
+// Local includes
+#include "libmesh/libmesh.h" // on_command_line()
+
+// FParser includes
+#include "libmesh/fparser_ad.hh"
+
+// C++ includes
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A process-wide cache of parsed and optimized FParser objects, keyed
+ * by the expression they were parsed from and the variables it was
+ * parsed with.
+ *
+ * \p ParsedFunction and \p ParsedFEMFunction take copies of the
+ * cached parsers rather than parsing, optimizing and differentiating
+ * each expression themselves, so that the clones of them made (per
+ * thread) by e.g. \p GenericProjector and \p DirichletBoundary come
+ * almost for free.
+ *
+ * If libMesh was configured with FParser JIT support and
+ * \p --fparser-jit is given on the command line, cached parsers are
+ * also JIT compiled, once per process, and all copies of them share
+ * the compiled code.  FParser keeps compiled code in a \p .jitcache
+ * subdirectory of the working directory, where later runs will find
+ * it.  JIT compiled functions do not detect evaluation errors (such
+ * as division by zero), which is why this is not the default.
+ *
+ * Each copy has its own bytecode data, so different copies can be
+ * evaluated concurrently, but a single copy can not be.
+ *
+ * \note Every distinct expression stays cached until \p clear() is
+ * called; code which generates many different expressions (e.g. by
+ * repeatedly calling \p ParsedFunction::set_inline_value()) may want
+ * to do so occasionally.
+ *
+ * \brief Process-wide cache of parsed expressions.
+ */
+template <typename Output>
+class FParserCache
+{
+public:
+  typedef FunctionParserADBase<Output> Parser;
+
+  /**
+   * The parsers built for one expression: the function itself first,
+   * then any derivatives of it its user needs.
+   */
+  struct Entry
+  {
+    std::vector<std::unique_ptr<Parser>> parsers;
+    bool valid_derivatives = true;
+  };
+
+  /**
+   * Fills \p entry with copies of the parsers cached for
+   * \p expression and \p variables, first calling \p build to create
+   * (and then JIT compiling) them if they are not cached yet.
+   */
+  static void get (const std::string & variables,
+                   const std::string & expression,
+                   const std::function<void (Entry &)> & build,
+                   Entry & entry);
+
+  /**
+   * Empties the cache.  Existing copies of cached parsers are
+   * unaffected.
+   */
+  static void clear ();
+
+  /**
+   * \returns The number of cached expressions.
+   */
+  static std::size_t size ();
+
+private:
+  /**
+   * A deep copy of a cached parser, with its own bytecode data.
+   */
+  class Copy : public Parser
+  {
+  public:
+    explicit Copy (const Parser & cached) :
+      Parser(cached)
+    {
+      this->ForceDeepCopy();
+
+      // The compiled code, if any, reads constants from our own
+      // data, not the cached parser's
+      this->updatePImmed();
+    }
+  };
+
+  typedef std::map<std::pair<std::string, std::string>, Entry> Map;
+
+  static Map & entries ()
+  {
+    static Map cache;
+    return cache;
+  }
+
+  static std::mutex & mutex ()
+  {
+    static std::mutex cache_mutex;
+    return cache_mutex;
+  }
+};
+
+
+
+template <typename Output>
+inline
+void
+FParserCache<Output>::get (const std::string & variables,
+                           const std::string & expression,
+                           const std::function<void (Entry &)> & build,
+                           Entry & entry)
+{
+  // Reference counts in parser data aren't atomic, so we copy cached
+  // parsers under the lock too
+  std::lock_guard<std::mutex> lock(mutex());
+
+  Map & cache = entries();
+
+  const auto key = std::make_pair(variables, expression);
+  auto it = cache.find(key);
+
+  if (it == cache.end())
+    {
+      // Don't cache anything if the build fails
+      Entry new_entry;
+      build(new_entry);
+
+#ifdef LIBMESH_HAVE_FPARSER_JIT
+      if (libMesh::on_command_line("--fparser-jit"))
+        for (auto & parser : new_entry.parsers)
+          parser->JITCompile();
+#endif
+
+      it = cache.emplace(key, std::move(new_entry)).first;
+    }
+
+  const Entry & cached = it->second;
+
+  entry.parsers.clear();
+  for (const auto & parser : cached.parsers)
+    entry.parsers.push_back(std::make_unique<Copy>(*parser));
+  entry.valid_derivatives = cached.valid_derivatives;
+}
+
+
+
+template <typename Output>
+inline
+void
+FParserCache<Output>::clear ()
+{
+  std::lock_guard<std::mutex> lock(mutex());
+  entries().clear();
+}
+
+
+
+template <typename Output>
+inline
+std::size_t
+FParserCache<Output>::size ()
+{
+  std::lock_guard<std::mutex> lock(mutex());
+  return entries().size();
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_HAVE_FPARSER
+
+#endif // LIBMESH_FPARSER_CACHE_H
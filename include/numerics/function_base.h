@@ -23,17 +23,16 @@
 // Local Includes
 #include "libmesh/libmesh_common.h"
 #include "libmesh/dense_vector.h" // required to instantiate a DenseVector<> below
+#include "libmesh/point.h"
 
 // C++ includes
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
 
-// Forward Declarations
-class Point;
-
 /**
  * \brief Base class for functors that can be evaluated at a point and
  * (optionally) time.
@@ -146,6 +145,20 @@ public:
                            const Point & p,
                            Real time=0.);
 
+  /**
+   * Evaluates the vector component \p i at each of \p points, at
+   * time \p time, into \p values, which is resized to match.
+   *
+   * The default implementation calls \p component() once per point.
+   * Subclasses which can evaluate many points at once more cheaply
+   * should override this; library code evaluating a function at
+   * all the quadrature points of an element uses it.
+   */
+  virtual void component_at_points (unsigned int i,
+                                    const std::vector<Point> & points,
+                                    Real time,
+                                    std::vector<Output> & values);
+
 
   /**
    * \returns \p true when this object is properly initialized
@@ -240,6 +253,20 @@ Output FunctionBase<Output>::component (unsigned int i,
 
 
 
+template <typename Output>
+inline
+void FunctionBase<Output>::component_at_points (unsigned int i,
+                                                const std::vector<Point> & points,
+                                                Real time,
+                                                std::vector<Output> & values)
+{
+  values.resize(points.size());
+  for (std::size_t p = 0; p != points.size(); ++p)
+    values[p] = this->component(i, points[p], time);
+}
+
+
+
 template <typename Output>
 inline
 void FunctionBase<Output>::operator() (const Point & p,
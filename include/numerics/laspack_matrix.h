@@ -86,6 +86,13 @@ public:
   virtual bool need_full_sparsity_pattern() const override
   { return true; }
 
+  /**
+   * Every entry of a preallocated row is stored separately, so
+   * threads adding to different rows don't interfere.
+   */
+  virtual bool supports_concurrent_disjoint_add() const override
+  { return true; }
+
   /**
    * Updates the matrix sparsity pattern.  This will tell the
    * underlying matrix storage scheme how to map the \f$ (i,j) \f$
@@ -93,6 +100,12 @@ public:
    */
   virtual void update_sparsity_pattern (const SparsityPattern::Graph &) override;
 
+  /**
+   * Same as above, but copies the column indices straight out of
+   * compressed storage.
+   */
+  virtual void update_sparsity_pattern (const SparsityPattern::CompressedGraph &) override;
+
   virtual void init (const numeric_index_type m,
                      const numeric_index_type n,
                      const numeric_index_type m_l,
@@ -185,6 +198,12 @@ private:
    */
   std::vector<std::vector<numeric_index_type>::const_iterator> _row_start;
 
+  /**
+   * Initializes the matrix, and its structure, from the
+   * already-filled \p _csr and \p _row_start.
+   */
+  void init_from_csr ();
+
   /**
    * Flag indicating if the matrix has been closed yet.
    */
@@ -36,6 +36,7 @@
 
 // C++ includes
 #include <limits>
+#include <type_traits>
 #include <mutex>
 
 namespace libMesh
@@ -166,6 +167,8 @@ public:
 
   virtual T operator() (const numeric_index_type i) const override;
 
+  virtual typename NumericVector<T>::LocalArray get_local_array_read () const override;
+
   virtual NumericVector<T> & operator += (const NumericVector<T> & v) override;
 
   virtual NumericVector<T> & operator -= (const NumericVector<T> & v) override;
@@ -531,6 +534,32 @@ void LaspackVector<T>::add (const numeric_index_type i, const T value)
 
 
 
+template <typename T>
+inline
+typename NumericVector<T>::LocalArray
+LaspackVector<T>::get_local_array_read () const
+{
+  libmesh_assert (this->initialized());
+
+  typename NumericVector<T>::LocalArray array;
+
+  // Laspack components are 1-based, and may be lazily scaled by
+  // Multipl; we can only expose them directly when they hold T
+  // values as-is.
+  if constexpr (std::is_same<T, _LPNumber>::value)
+    if (_vec.Multipl == 1)
+      {
+        array.values = _vec.Cmp + 1;
+        array.first = 0;
+        array.last = this->size();
+        array.size = this->size();
+      }
+
+  return array;
+}
+
+
+
 template <typename T>
 inline
 T LaspackVector<T>::operator() (const numeric_index_type i) const
@@ -37,6 +37,7 @@
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 
 namespace libMesh
 {
@@ -157,6 +158,14 @@ public:
    */
   ParallelType & type() { return _type; }
 
+  /**
+   * Sets a prefix for the solver package options which configure
+   * this vector the next time it is initialized.  With PETSc, for
+   * instance, a prefix of "foo_" lets "-foo_vec_type cuda" put the
+   * vector on a device.  Packages without such options ignore it.
+   */
+  virtual void set_options_prefix (const std::string &) {}
+
   /**
    * \returns \p true if the vector is closed and ready for
    * computation, false otherwise.
@@ -368,6 +377,51 @@ public:
   void get(const std::vector<numeric_index_type> & index,
            std::vector<T> & values) const;
 
+  /**
+   * A description of the contiguous storage of the entries of a
+   * vector which are available on this processor; see
+   * get_local_array_read() and NumericVectorConstView.
+   */
+  struct LocalArray
+  {
+    /**
+     * The entries with global indices in [first, last), followed by
+     * any ghost entries, or nullptr if the vector has no such
+     * storage.
+     */
+    const T * values = nullptr;
+
+    /**
+     * The range of global indices stored contiguously at the start of
+     * \p values.
+     */
+    numeric_index_type first = 0, last = 0;
+
+    /**
+     * The total number of entries in \p values.
+     */
+    std::size_t size = 0;
+
+    /**
+     * For ghosted vectors, a map from the global index of each ghost
+     * entry to its position in \p values after the first
+     * (last - first) entries; nullptr otherwise.
+     */
+    const std::unordered_map<numeric_index_type, numeric_index_type> * ghosts = nullptr;
+  };
+
+  /**
+   * \returns A description of the contiguous storage of the entries
+   * available on this processor, which remains valid until the
+   * vector is next modified or closed.  The default implementation
+   * returns a null \p values pointer, for subclasses without such
+   * storage.
+   *
+   * Use a NumericVectorConstView to read entries through this
+   * without any per-entry virtual function calls.
+   */
+  virtual LocalArray get_local_array_read () const { return LocalArray(); }
+
   /**
    * Adds \p v to *this,
    * \f$ \vec{u} \leftarrow \vec{u} + \vec{v} \f$.
@@ -578,6 +632,41 @@ public:
    */
   virtual T dot(const NumericVector<T> & v) const = 0;
 
+  /**
+   * Sets \f$ \vec{u} \leftarrow \alpha \vec{x} + \beta \vec{y} +
+   * \gamma \vec{u} \f$.
+   *
+   * Backends which support it do this in a single pass over the
+   * vectors, rather than one pass per term.  Either of \p x or \p y
+   * may alias (*this).
+   */
+  virtual void axpbypcz (const T alpha, const NumericVector<T> & x,
+                         const T beta, const NumericVector<T> & y,
+                         const T gamma);
+
+  /**
+   * Sets \f$ \vec{u} \leftarrow \vec{u} + \sum_i \alpha_i \vec{v}_i \f$,
+   * where \f$ \alpha_i \f$ is \p alphas[i] and \f$ \vec{v}_i \f$ is
+   * \p *vecs[i].
+   *
+   * Backends which support it do this in a single pass over (*this).
+   * Any of \p vecs may alias (*this).
+   */
+  virtual void maxpy (const std::vector<T> & alphas,
+                      const std::vector<const NumericVector<T> *> & vecs);
+
+  /**
+   * Fills \p dots with the dot products of (*this) with each of
+   * \p vecs, using the complex-conjugate of each vector as in
+   * \p dot().
+   *
+   * All of the products are computed with a single parallel
+   * reduction.  Including (*this) in \p vecs gives the square of
+   * its l2 norm alongside the other products.
+   */
+  virtual void mdot (const std::vector<const NumericVector<T> *> & vecs,
+                     std::vector<T> & dots) const;
+
   /**
    * Creates a copy of the global vector in the local vector \p
    * v_local.
@@ -597,6 +686,25 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const = 0;
 
+  /**
+   * Starts the same operation as localize(v_local, send_list), but
+   * may return before the values for the \p send_list have arrived,
+   * so that the caller can do other work while they are in flight.
+   * Only the locally owned entries of \p v_local may be read until
+   * end_localize() has been called with the same \p v_local.
+   *
+   * The default implementation does the whole localization here.
+   */
+  virtual void begin_localize (NumericVector<T> & v_local,
+                               const std::vector<numeric_index_type> & send_list) const;
+
+  /**
+   * Finishes a localization started by begin_localize(v_local, ...).
+   *
+   * The default implementation does nothing.
+   */
+  virtual void end_localize (NumericVector<T> & v_local) const;
+
   /**
    * Fill in the local std::vector "v_local" with the global indices
    * given in "indices".
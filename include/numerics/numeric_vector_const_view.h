@@ -0,0 +1,175 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_NUMERIC_VECTOR_CONST_VIEW_H
+#define LIBMESH_NUMERIC_VECTOR_CONST_VIEW_H
+
+// Local includes
+#include "libmesh/numeric_vector.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A read-only view of the entries of a NumericVector which are
+ * available on this processor: the locally owned entries and, for
+ * ghosted vectors, the ghost entries.
+ *
+ * Construction makes a single virtual call to
+ * NumericVector::get_local_array_read(); after that every access is
+ * an inlined index lookup into contiguous storage, with no virtual
+ * dispatch or lazy array state, so a view can be hoisted out of
+ * element loops that read many entries.  For vector types with no
+ * contiguous local storage, the locally owned entries are copied
+ * into the view instead.
+ *
+ * A view is only valid until the underlying vector is next modified
+ * or closed.
+ *
+ * \brief Read-only bulk access to local NumericVector entries.
+ */
+template <typename T>
+class NumericVectorConstView
+{
+public:
+  /**
+   * Constructor.  Views the local entries of \p vec.
+   */
+  explicit
+  NumericVectorConstView (const NumericVector<T> & vec);
+
+  /**
+   * \returns The position in data() of the entry with global index
+   * \p i, which must be locally owned or ghosted.
+   */
+  std::size_t local_index (const numeric_index_type i) const;
+
+  /**
+   * \returns The entry with global index \p i.
+   */
+  T operator() (const numeric_index_type i) const
+  { return _values[this->local_index(i)]; }
+
+  /**
+   * Reads the entries with global indices \p index into \p values,
+   * which is resized if necessary.
+   */
+  void get (const std::vector<numeric_index_type> & index,
+            std::vector<T> & values) const;
+
+  /**
+   * \returns The contiguous local entries: the locally owned entries
+   * in global index order, followed by any ghost entries.
+   */
+  const T * data () const { return _values; }
+
+  /**
+   * \returns The number of entries in data().
+   */
+  std::size_t size () const { return _size; }
+
+private:
+
+  /**
+   * Storage for a copy of the owned entries, for vector types with
+   * no contiguous local storage of their own.
+   */
+  std::vector<T> _copy;
+
+  const T * _values;
+
+  numeric_index_type _first, _last;
+
+  std::size_t _size;
+
+  const std::unordered_map<numeric_index_type, numeric_index_type> * _ghosts;
+};
+
+
+
+// ------------------------------------------------------------
+// NumericVectorConstView inline methods
+template <typename T>
+inline
+NumericVectorConstView<T>::NumericVectorConstView (const NumericVector<T> & vec)
+{
+  const typename NumericVector<T>::LocalArray array =
+    vec.get_local_array_read();
+
+  if (array.values)
+    {
+      _values = array.values;
+      _first = array.first;
+      _last = array.last;
+      _size = array.size;
+      _ghosts = array.ghosts;
+    }
+  else
+    {
+      _first = vec.first_local_index();
+      _last = vec.last_local_index();
+
+      std::vector<numeric_index_type> indices(_last - _first);
+      for (auto i : index_range(indices))
+        indices[i] = _first + i;
+      vec.get(indices, _copy);
+
+      _values = _copy.data();
+      _size = _copy.size();
+      _ghosts = nullptr;
+    }
+}
+
+
+
+template <typename T>
+inline
+std::size_t
+NumericVectorConstView<T>::local_index (const numeric_index_type i) const
+{
+  if (i >= _first && i < _last)
+    return i - _first;
+
+  libmesh_assert_msg(_ghosts, "No index " << i << " in unghosted view");
+  const auto it = _ghosts->find(i);
+  libmesh_assert_msg(it != _ghosts->end(), "No index " << i << " in view");
+  libmesh_assert_less(it->second + (_last - _first), _size);
+
+  return it->second + (_last - _first);
+}
+
+
+
+template <typename T>
+inline
+void
+NumericVectorConstView<T>::get (const std::vector<numeric_index_type> & index,
+                                std::vector<T> & values) const
+{
+  values.resize(index.size());
+  for (auto i : index_range(index))
+    values[i] = _values[this->local_index(index[i])];
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_NUMERIC_VECTOR_CONST_VIEW_H
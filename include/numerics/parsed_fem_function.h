@@ -30,7 +30,8 @@
 
 #ifdef LIBMESH_HAVE_FPARSER
 // FParser includes
-#include "libmesh/fparser.hh"
+#include "libmesh/fparser_ad.hh"
+#include "libmesh/fparser_cache.h"
 #endif
 
 // C++ includes
@@ -104,6 +105,12 @@ public:
                            const Point & p,
                            Real time=0.) override;
 
+  virtual void component_at_points (const FEMContext & c,
+                                    unsigned int i,
+                                    const std::vector<Point> & points,
+                                    Real time,
+                                    std::vector<Output> & values) override;
+
   const std::string & expression() { return _expression; }
 
   /**
@@ -144,7 +151,7 @@ protected:
 
   // Evaluate the ith FunctionParser and check the result
 #ifdef LIBMESH_HAVE_FPARSER
-  inline Output eval(FunctionParserBase<Output> & parser,
+  inline Output eval(FunctionParserADBase<Output> & parser,
                      std::string_view libmesh_dbg_var(function_name),
                      unsigned int libmesh_dbg_var(component_idx)) const;
 #else // LIBMESH_HAVE_FPARSER
@@ -163,7 +170,7 @@ private:
     _n_requested_hess_components;
   bool _requested_normals;
 #ifdef LIBMESH_HAVE_FPARSER
-  std::vector<std::unique_ptr<FunctionParserBase<Output>>> parsers;
+  std::vector<std::unique_ptr<FunctionParserADBase<Output>>> parsers;
 #else
   std::vector<char*> parsers;
 #endif
@@ -475,6 +482,25 @@ ParsedFEMFunction<Output>::component (const FEMContext & c,
   return eval(*parsers[i], "f", i);
 }
 
+template <typename Output>
+inline
+void
+ParsedFEMFunction<Output>::component_at_points (const FEMContext & c,
+                                                unsigned int i,
+                                                const std::vector<Point> & points,
+                                                Real time,
+                                                std::vector<Output> & values)
+{
+  libmesh_assert_less (i, parsers.size());
+
+  values.resize(points.size());
+  for (auto p : index_range(points))
+    {
+      eval_args(c, points[p], time);
+      values[p] = eval(*parsers[i], "f", i);
+    }
+}
+
 template <typename Output>
 inline
 Output
@@ -515,7 +541,7 @@ ParsedFEMFunction<Output>::get_inline_value(std::string_view inline_var_name) co
 #ifdef LIBMESH_HAVE_FPARSER
       // Parse and evaluate the new subexpression.
       // Add the same constants as we used originally.
-      auto fp = std::make_unique<FunctionParserBase<Output>>();
+      auto fp = std::make_unique<FunctionParserADBase<Output>>();
       fp->AddConstant("NaN", std::numeric_limits<Real>::quiet_NaN());
       fp->AddConstant("pi", std::acos(Real(-1)));
       fp->AddConstant("e", std::exp(Real(1)));
@@ -655,18 +681,29 @@ ParsedFEMFunction<Output>::partial_reparse (std::string expression)
 
 
 #ifdef LIBMESH_HAVE_FPARSER
-      // Parse (and optimize if possible) the subexpression.
-      // Add some basic constants, to Real precision.
-      auto fp = std::make_unique<FunctionParserBase<Output>>();
-      fp->AddConstant("NaN", std::numeric_limits<Real>::quiet_NaN());
-      fp->AddConstant("pi", std::acos(Real(-1)));
-      fp->AddConstant("e", std::exp(Real(1)));
-      libmesh_error_msg_if
-        (fp->Parse(_subexpressions.back(), variables) != -1, // -1 for success
-         "ERROR: FunctionParser is unable to parse expression: "
-         << _subexpressions.back() << '\n' << fp->ErrorMsg());
-      fp->Optimize();
-      parsers.push_back(std::move(fp));
+      // Parse (and optimize if possible) the subexpression, or copy
+      // the parser from whoever did so before us.
+      typename FParserCache<Output>::Entry entry;
+      FParserCache<Output>::get
+        (variables, _subexpressions.back(),
+         [this](typename FParserCache<Output>::Entry & new_entry)
+         {
+           // Add some basic constants, to Real precision.
+           auto fp = std::make_unique<FunctionParserADBase<Output>>();
+           fp->AddConstant("NaN", std::numeric_limits<Real>::quiet_NaN());
+           fp->AddConstant("pi", std::acos(Real(-1)));
+           fp->AddConstant("e", std::exp(Real(1)));
+           libmesh_error_msg_if
+             (fp->Parse(_subexpressions.back(), variables) != -1, // -1 for success
+              "ERROR: FunctionParser is unable to parse expression: "
+              << _subexpressions.back() << '\n' << fp->ErrorMsg());
+           fp->Optimize();
+           new_entry.parsers.push_back(std::move(fp));
+         },
+         entry);
+
+      libmesh_assert_equal_to(entry.parsers.size(), 1);
+      parsers.push_back(std::move(entry.parsers[0]));
 #else
       libmesh_error_msg("ERROR: This functionality requires fparser!");
 #endif
@@ -836,7 +873,7 @@ ParsedFEMFunction<Output>::eval_args (const FEMContext & c,
 template <typename Output>
 inline
 Output
-ParsedFEMFunction<Output>::eval (FunctionParserBase<Output> & parser,
+ParsedFEMFunction<Output>::eval (FunctionParserADBase<Output> & parser,
                                  std::string_view libmesh_dbg_var(function_name),
                                  unsigned int libmesh_dbg_var(component_idx)) const
 {
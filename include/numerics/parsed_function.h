@@ -25,6 +25,7 @@
 
 // Local includes
 #include "libmesh/dense_vector.h"
+#include "libmesh/fparser_cache.h"
 #include "libmesh/int_range.h"
 #include "libmesh/vector_value.h"
 #include "libmesh/point.h"
@@ -104,6 +105,11 @@ public:
                             const Point & p,
                             Real time) override;
 
+  virtual void component_at_points (unsigned int i,
+                                    const std::vector<Point> & points,
+                                    Real time,
+                                    std::vector<Output> & values) override;
+
   const std::string & expression() { return _expression; }
 
   /**
@@ -350,6 +356,25 @@ ParsedFunction<Output,OutputGradient>::component (unsigned int i,
   return eval(*parsers[i], "f", i);
 }
 
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::component_at_points (unsigned int i,
+                                                            const std::vector<Point> & points,
+                                                            Real time,
+                                                            std::vector<Output> & values)
+{
+  libmesh_assert_less (i, parsers.size());
+  FunctionParserADBase<Output> & parser = *parsers[i];
+
+  values.resize(points.size());
+  for (auto p : index_range(points))
+    {
+      set_spacetime(points[p], time);
+      values[p] = eval(parser, "f", i);
+    }
+}
+
 /**
  * \returns The address of a parsed variable so you can supply a parameterized value
  */
@@ -524,6 +549,14 @@ ParsedFunction<Output,OutputGradient>::partial_reparse (std::string expression)
   _expression = std::move(expression);
   _subexpressions.clear();
   parsers.clear();
+  dx_parsers.clear();
+#if LIBMESH_DIM > 1
+  dy_parsers.clear();
+#endif
+#if LIBMESH_DIM > 2
+  dz_parsers.clear();
+#endif
+  dt_parsers.clear();
 
   size_t nextstart = 0, end = 0;
 
@@ -555,55 +588,77 @@ ParsedFunction<Output,OutputGradient>::partial_reparse (std::string expression)
       libmesh_error_msg_if(_subexpressions.back().empty(),
                            "ERROR: FunctionParser is unable to parse empty expression.\n");
 
-      // Parse (and optimize if possible) the subexpression.
-      // Add some basic constants, to Real precision.
-      auto fp = std::make_unique<FunctionParserADBase<Output>>();
-      fp->AddConstant("NaN", std::numeric_limits<Real>::quiet_NaN());
-      fp->AddConstant("pi", std::acos(Real(-1)));
-      fp->AddConstant("e", std::exp(Real(1)));
-      libmesh_error_msg_if
-        (fp->Parse(_subexpressions.back(), variables) != -1, // -1 for success
-         "ERROR: FunctionParser is unable to parse expression: "
-         << _subexpressions.back() << '\n' << fp->ErrorMsg());
-
-      // use of derivatives is optional. suppress error output on the console
-      // use the has_derivatives() method to check if AutoDiff was successful.
-      // also enable immediate optimization
-      fp->SetADFlags(FunctionParserADBase<Output>::ADSilenceErrors |
-                    FunctionParserADBase<Output>::ADAutoOptimize);
-
-      // optimize original function
-      fp->Optimize();
-
-      // generate derivatives through automatic differentiation
-      auto dx_fp = std::make_unique<FunctionParserADBase<Output>>(*fp);
-      if (dx_fp->AutoDiff("x") != -1) // -1 for success
-        _valid_derivatives = false;
-      dx_parsers.push_back(std::move(dx_fp));
+      // Parse (and optimize if possible) the subexpression, or copy
+      // the parsers from whoever did so before us.
+      typename FParserCache<Output>::Entry entry;
+      FParserCache<Output>::get
+        (variables, _subexpressions.back(),
+         [this](typename FParserCache<Output>::Entry & new_entry)
+         {
+           // Add some basic constants, to Real precision.
+           auto fp = std::make_unique<FunctionParserADBase<Output>>();
+           fp->AddConstant("NaN", std::numeric_limits<Real>::quiet_NaN());
+           fp->AddConstant("pi", std::acos(Real(-1)));
+           fp->AddConstant("e", std::exp(Real(1)));
+           libmesh_error_msg_if
+             (fp->Parse(_subexpressions.back(), variables) != -1, // -1 for success
+              "ERROR: FunctionParser is unable to parse expression: "
+              << _subexpressions.back() << '\n' << fp->ErrorMsg());
+
+           // use of derivatives is optional. suppress error output on the console
+           // use the has_derivatives() method to check if AutoDiff was successful.
+           // also enable immediate optimization
+           fp->SetADFlags(FunctionParserADBase<Output>::ADSilenceErrors |
+                         FunctionParserADBase<Output>::ADAutoOptimize);
+
+           // optimize original function
+           fp->Optimize();
+
+           // generate derivatives through automatic differentiation,
+           // in the order x, y, z, t
+           std::vector<std::string> diff_vars = {"x"};
 #if LIBMESH_DIM > 1
-      auto dy_fp = std::make_unique<FunctionParserADBase<Output>>(*fp);
-      if (dy_fp->AutoDiff("y") != -1) // -1 for success
-        _valid_derivatives = false;
-      dy_parsers.push_back(std::move(dy_fp));
+           diff_vars.push_back("y");
 #endif
 #if LIBMESH_DIM > 2
-      auto dz_fp = std::make_unique<FunctionParserADBase<Output>>(*fp);
-      if (dz_fp->AutoDiff("z") != -1) // -1 for success
-        _valid_derivatives = false;
-      dz_parsers.push_back(std::move(dz_fp));
+           diff_vars.push_back("z");
 #endif
-      auto dt_fp = std::make_unique<FunctionParserADBase<Output>>(*fp);
-      if (dt_fp->AutoDiff("t") != -1) // -1 for success
+           diff_vars.push_back("t");
+
+           std::vector<std::unique_ptr<FunctionParserADBase<Output>>> d_fps;
+           for (const auto & diff_var : diff_vars)
+             {
+               auto d_fp = std::make_unique<FunctionParserADBase<Output>>(*fp);
+               if (d_fp->AutoDiff(diff_var) != -1) // -1 for success
+                 new_entry.valid_derivatives = false;
+               d_fps.push_back(std::move(d_fp));
+             }
+
+           new_entry.parsers.push_back(std::move(fp));
+           for (auto & d_fp : d_fps)
+             new_entry.parsers.push_back(std::move(d_fp));
+         },
+         entry);
+
+      if (!entry.valid_derivatives)
         _valid_derivatives = false;
-      dt_parsers.push_back(std::move(dt_fp));
+
+      auto parser_it = entry.parsers.begin();
+      parsers.push_back(std::move(*parser_it++));
+      dx_parsers.push_back(std::move(*parser_it++));
+#if LIBMESH_DIM > 1
+      dy_parsers.push_back(std::move(*parser_it++));
+#endif
+#if LIBMESH_DIM > 2
+      dz_parsers.push_back(std::move(*parser_it++));
+#endif
+      dt_parsers.push_back(std::move(*parser_it++));
+      libmesh_assert(parser_it == entry.parsers.end());
 
       // If at end, use nextstart=maxSize.  Else start at next
       // character.
       nextstart = (end == std::string::npos) ?
         std::string::npos : end + 1;
-
-      // Store fp for later use
-      parsers.push_back(std::move(fp));
     }
 }
 
@@ -75,9 +75,15 @@ namespace libMesh
 // Forward Declarations
 template <typename T> class DenseMatrix;
 
+/**
+ * The PETSc storage formats PetscMatrix can create.  BAIJ matrices
+ * fall back to AIJ if the sparsity pattern they are initialized with
+ * doesn't have a uniform block structure.
+ */
 enum PetscMatrixType : int {
                  AIJ=0,
-                 HYPRE};
+                 HYPRE,
+                 BAIJ};
 
 
 /**
@@ -128,8 +134,24 @@ public:
   PetscMatrix & operator= (PetscMatrix &&) = delete;
   virtual ~PetscMatrix ();
 
+  /**
+   * Sets the storage format to create on the next init().  The
+   * default AIJ format can also be switched to BAIJ for matrices
+   * initialized from a DofMap by the \p --use-petsc-baij command line
+   * option.  BAIJ is used with the DofMap::block_size() of the
+   * matrix, when every row in each block has the same, block-divisible
+   * preallocation; otherwise the matrix is created as AIJ.
+   */
   void set_matrix_type(PetscMatrixType mat_type);
 
+  /**
+   * Sets the options prefix used when this matrix is created, so
+   * that e.g. "-<prefix>mat_type aijcusparse" or "aijkokkos" can
+   * select device storage for it alone.  The default empty prefix
+   * means the matrix is configured by the unprefixed options.
+   */
+  virtual void set_options_prefix (const std::string & prefix) override;
+
   virtual void init (const numeric_index_type m,
                      const numeric_index_type n,
                      const numeric_index_type m_l,
@@ -233,6 +255,18 @@ public:
                                  const std::vector<numeric_index_type> & dof_indices) override
   { this->add_block_matrix (dm, dof_indices, dof_indices); }
 
+  /**
+   * Uses PETSc's \p MatSetPreallocationCOO() and \p MatSetValuesCOO()
+   * when available.  The COO pattern is cached, so repeated calls
+   * with the same \p rows and \p cols only pay for the values.
+   *
+   * \note Preallocating for COO replaces the nonzero structure of the
+   * matrix with the pattern of the given entries.
+   */
+  virtual void set_from_coo (const std::vector<numeric_index_type> & rows,
+                             const std::vector<numeric_index_type> & cols,
+                             const std::vector<T> & values) override;
+
   /**
    * Compute A += a*X for scalar \p a, matrix \p X.
    *
@@ -357,6 +391,17 @@ private:
 
   PetscMatrixType _mat_type;
 
+  /**
+   * The PETSc options prefix for this matrix
+   */
+  std::string _options_prefix;
+
+  /**
+   * The COO pattern we last preallocated \p _mat with in \p
+   * set_from_coo(), if any.
+   */
+  std::vector<numeric_index_type> _coo_rows, _coo_cols;
+
 #ifdef LIBMESH_HAVE_CXX11_THREAD
   mutable std::mutex _petsc_matrix_mutex;
 #else
@@ -207,6 +207,8 @@ public:
   virtual void get(const std::vector<numeric_index_type> & index,
                    T * values) const override;
 
+  virtual typename NumericVector<T>::LocalArray get_local_array_read () const override;
+
   /**
    * Get read/write access to the raw PETSc Vector data array.
    *
@@ -294,6 +296,16 @@ public:
 
   virtual T dot(const NumericVector<T> & v) const override;
 
+  virtual void axpbypcz (const T alpha, const NumericVector<T> & x,
+                         const T beta, const NumericVector<T> & y,
+                         const T gamma) override;
+
+  virtual void maxpy (const std::vector<T> & alphas,
+                      const std::vector<const NumericVector<T> *> & vecs) override;
+
+  virtual void mdot (const std::vector<const NumericVector<T> *> & vecs,
+                     std::vector<T> & dots) const override;
+
   /**
    * \returns The dot product of (*this) with the vector \p v.
    *
@@ -308,6 +320,20 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const override;
 
+  /**
+   * When \p v_local is GHOSTED and (*this) is PARALLEL, copies the
+   * owned entries and starts a VecGhostUpdateBegin(); otherwise
+   * localizes completely.
+   */
+  virtual void begin_localize (NumericVector<T> & v_local,
+                               const std::vector<numeric_index_type> & send_list) const override;
+
+  /**
+   * Calls VecGhostUpdateEnd() if begin_localize() started a ghost
+   * update on \p v_local.
+   */
+  virtual void end_localize (NumericVector<T> & v_local) const override;
+
   virtual void localize (std::vector<T> & v_local,
                          const std::vector<numeric_index_type> & indices) const override;
 
@@ -331,6 +357,15 @@ public:
 
   virtual void swap (NumericVector<T> & v) override;
 
+  /**
+   * Sets the options prefix used when this vector is created, so
+   * that e.g. "-<prefix>vec_type cuda" or "kokkos" can select device
+   * storage for it alone.  Ghosted vectors additionally append
+   * "ghost_" to the prefix.
+   */
+  virtual void set_options_prefix (const std::string & prefix) override
+  { _options_prefix = prefix; }
+
   virtual std::size_t max_allowed_id() const override;
 
   /**
@@ -459,6 +494,11 @@ private:
    * Whether or not the data array is for read only access
    */
   mutable bool _values_read_only;
+
+  /**
+   * The PETSc options prefix for this vector
+   */
+  std::string _options_prefix;
 };
 
 
@@ -698,6 +738,8 @@ void PetscVector<T>::init (const numeric_index_type n,
     {
       ierr = VecCreate(PETSC_COMM_SELF, &_vec);CHKERRABORT(PETSC_COMM_SELF,ierr);
       ierr = VecSetSizes(_vec, petsc_n, petsc_n); CHKERRABORT(PETSC_COMM_SELF,ierr);
+      ierr = VecSetOptionsPrefix(_vec, _options_prefix.c_str());
+      CHKERRABORT(PETSC_COMM_SELF,ierr);
       ierr = VecSetFromOptions (_vec);
       CHKERRABORT(PETSC_COMM_SELF,ierr);
     }
@@ -715,6 +757,8 @@ void PetscVector<T>::init (const numeric_index_type n,
       ierr = VecCreate(PETSC_COMM_SELF, &_vec);CHKERRABORT(PETSC_COMM_SELF,ierr);
       ierr = VecSetSizes(_vec, petsc_n, petsc_n); CHKERRABORT(PETSC_COMM_SELF,ierr);
 #endif
+      ierr = VecSetOptionsPrefix(_vec, _options_prefix.c_str());
+      LIBMESH_CHKERR(ierr);
       ierr = VecSetFromOptions (_vec);
       LIBMESH_CHKERR(ierr);
     }
@@ -796,6 +840,8 @@ void PetscVector<T>::init (const numeric_index_type n,
   // nonghosted vector when using a petsc option.
   // PETSc does not fully support VecGhost on GPU yet. This change allows us to
   // trigger a nonghosted vector to use GPU without bothering the ghosted vectors.
+  ierr = VecSetOptionsPrefix(_vec, _options_prefix.c_str());
+  LIBMESH_CHKERR(ierr);
   ierr = PetscObjectAppendOptionsPrefix((PetscObject)_vec,"ghost_");
   LIBMESH_CHKERR(ierr);
 
@@ -1141,6 +1187,26 @@ void PetscVector<T>::get(const std::vector<numeric_index_type> & index,
 }
 
 
+template <typename T>
+inline
+typename NumericVector<T>::LocalArray
+PetscVector<T>::get_local_array_read () const
+{
+  this->_get_array(true);
+
+  typename NumericVector<T>::LocalArray array;
+  array.values = reinterpret_cast<const T *>(_read_only_values);
+  array.first = _first;
+  array.last = _last;
+  array.size = _local_size;
+  if (this->type() == GHOSTED)
+    array.ghosts = &_global_to_local_map;
+
+  return array;
+}
+
+
+
 template <typename T>
 inline
 PetscScalar * PetscVector<T>::get_array()
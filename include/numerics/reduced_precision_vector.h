@@ -0,0 +1,131 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_REDUCED_PRECISION_VECTOR_H
+#define LIBMESH_REDUCED_PRECISION_VECTOR_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// C++ includes
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class NumericVector;
+
+/**
+ * The single precision counterpart of the scalar type \p T.
+ */
+template <typename T>
+struct ReducedPrecision
+{
+  typedef float type;
+};
+
+template <typename T>
+struct ReducedPrecision<std::complex<T>>
+{
+  typedef std::complex<float> type;
+};
+
+/**
+ * A single precision copy of the locally owned entries of a
+ * NumericVector, for data which is kept around for a long time but
+ * doesn't need full precision: old solutions in a solution history,
+ * error indicators, output-only fields.  With double precision
+ * \p Number it takes half the memory of the vector it was made from.
+ *
+ * The entries are rounded to single precision by store() and widened
+ * again by restore(), so a round trip loses everything past about
+ * seven significant digits.  Values outside the range of \p float
+ * overflow to infinity.
+ */
+template <typename T>
+class ReducedPrecisionVector
+{
+public:
+  /**
+   * The type each entry is stored as.
+   */
+  typedef typename ReducedPrecision<T>::type value_type;
+
+  /**
+   * Creates an empty copy.
+   */
+  ReducedPrecisionVector () = default;
+
+  /**
+   * Creates a copy of the local entries of \p v.
+   */
+  explicit
+  ReducedPrecisionVector (const NumericVector<T> & v);
+
+  /**
+   * Replaces the stored entries with the local entries of \p v.
+   */
+  void store (const NumericVector<T> & v);
+
+  /**
+   * Sets the local entries of \p v, which must have been partitioned
+   * like the vector last passed to store(), to the stored values,
+   * and closes \p v.
+   */
+  void restore (NumericVector<T> & v) const;
+
+  /**
+   * \returns The number of stored entries.
+   */
+  std::size_t size () const { return _values.size(); }
+
+  /**
+   * \returns The global index of the first stored entry.
+   */
+  numeric_index_type first_local_index () const { return _first_local_index; }
+
+  /**
+   * Releases the stored entries.
+   */
+  void clear ();
+
+private:
+  /**
+   * The global index of the first stored entry.
+   */
+  numeric_index_type _first_local_index = 0;
+
+  /**
+   * The size of the vector the entries came from.
+   */
+  numeric_index_type _global_size = 0;
+
+  /**
+   * The stored entries.
+   */
+  std::vector<value_type> _values;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_REDUCED_PRECISION_VECTOR_H
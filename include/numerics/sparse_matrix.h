@@ -46,6 +46,7 @@ class DofMap;
 namespace SparsityPattern {
   class Build;
   class Graph;
+  class CompressedGraph;
 }
 template <typename T> class NumericVector;
 
@@ -138,6 +139,17 @@ public:
   virtual bool need_full_sparsity_pattern() const
   { return false; }
 
+  /**
+   * \returns \p true if add() and add_matrix() may be called
+   * concurrently from different threads, so long as no two threads
+   * add to the same row.
+   *
+   * This is false by default, and in particular for \p PetscMatrix,
+   * since PETSc does not support concurrent insertion.
+   */
+  virtual bool supports_concurrent_disjoint_add() const
+  { return false; }
+
   /**
    * Updates the matrix sparsity pattern. When your \p SparseMatrix<T>
    * implementation does not need this data, simply do not override
@@ -145,6 +157,23 @@ public:
    */
   virtual void update_sparsity_pattern (const SparsityPattern::Graph &) {}
 
+  /**
+   * Sets a prefix for the solver package options which configure
+   * this matrix the next time it is initialized.  With PETSc, for
+   * instance, a prefix of "foo_" lets "-foo_mat_type aijcusparse" put
+   * the matrix on a device.  Packages without such options ignore it.
+   */
+  virtual void set_options_prefix (const std::string &) {}
+
+  /**
+   * Updates the matrix sparsity pattern from compressed (CSR)
+   * storage.  The default implementation expands the pattern into a
+   * \p SparsityPattern::Graph and passes that to
+   * update_sparsity_pattern(); implementations which store CSR data
+   * themselves should override this to avoid the copy.
+   */
+  virtual void update_sparsity_pattern (const SparsityPattern::CompressedGraph &);
+
   /**
    * Initialize SparseMatrix with the specified sizes.
    *
@@ -292,6 +321,28 @@ public:
                                  const std::vector<numeric_index_type> & dof_indices)
   { this->add_block_matrix (dm, dof_indices, dof_indices); }
 
+  /**
+   * Replaces the contents of the matrix with the sum of the
+   * coordinate-format ("COO") entries \p values[i] at
+   * (\p rows[i], \p cols[i]).  Repeated entries are summed, and
+   * rows owned by other processors may be included.  This is a
+   * collective operation.
+   *
+   * This lets an assembly routine stage many element contributions
+   * and hand them over in a single call, which is considerably
+   * cheaper than one \p add_matrix() call per element for matrices
+   * which have a native COO interface.  The default implementation
+   * simply calls \p zero() and then \p add() for each entry.
+   *
+   * \note Some implementations (e.g. \p PetscMatrix) replace the
+   * sparsity pattern of the matrix with the pattern of the given
+   * entries, so any entry not listed here may be unavailable to later
+   * \p add() calls.
+   */
+  virtual void set_from_coo (const std::vector<numeric_index_type> & rows,
+                             const std::vector<numeric_index_type> & cols,
+                             const std::vector<T> & values);
+
   /**
    * Compute \f$ A \leftarrow A + a*X \f$ for scalar \p a, matrix \p X.
    */
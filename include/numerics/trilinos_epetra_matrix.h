@@ -110,6 +110,8 @@ public:
    */
   virtual void update_sparsity_pattern (const SparsityPattern::Graph &) override;
 
+  using SparseMatrix<T>::update_sparsity_pattern;
+
   virtual void init (const numeric_index_type m,
                      const numeric_index_type n,
                      const numeric_index_type m_l,
@@ -90,6 +90,13 @@ public:
                             Real time=0.) override
   { return _func->component(i, p, time); }
 
+  virtual void component_at_points (const FEMContext &,
+                                    unsigned int i,
+                                    const std::vector<Point> & points,
+                                    Real time,
+                                    std::vector<Output> & values) override
+  { _func->component_at_points(i, points, time, values); }
+
 protected:
 
   std::unique_ptr<FunctionBase<Output>> _func;
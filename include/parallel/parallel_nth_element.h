@@ -0,0 +1,139 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PARALLEL_NTH_ELEMENT_H
+#define LIBMESH_PARALLEL_NTH_ELEMENT_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/int_range.h"
+
+// TIMPI includes
+#include "timpi/communicator.h"
+#include "timpi/parallel_implementation.h"
+
+// C++ Includes
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+namespace Parallel
+{
+
+/**
+ * \returns The value which would be at position \p n (counting from
+ * zero) if the values in \p local_values on every processor of \p
+ * comm were gathered together and sorted in ascending order.
+ *
+ * The values are never gathered: this is a distributed quickselect,
+ * in which each processor nominates the median of its remaining
+ * values and the median of those nominations, weighted by how many
+ * values each processor has left, is used as the pivot.  That
+ * discards at least a quarter of the remaining values per round, so
+ * only O(log N) rounds of O(P) sized communication are needed before
+ * the few values left are gathered to finish the selection.
+ *
+ * \p T must be ordered by \p operator< and communicable by TIMPI.
+ * \p local_values is reordered and shrunk; every processor gets the
+ * same result.
+ */
+template <typename T>
+T nth_element (const Communicator & comm,
+               std::vector<T> & local_values,
+               largest_id_type n)
+{
+  largest_id_type n_remaining = local_values.size();
+  comm.sum(n_remaining);
+  libmesh_assert_less (n, n_remaining);
+
+  // Below this many values a gather is cheaper than more rounds
+  const largest_id_type gather_size = 64 * largest_id_type(comm.size());
+
+  while (n_remaining > gather_size)
+    {
+      std::vector<T> medians;
+      std::vector<largest_id_type> weights;
+      if (!local_values.empty())
+        {
+          auto mid = local_values.begin() + local_values.size() / 2;
+          std::nth_element(local_values.begin(), mid, local_values.end());
+          medians.push_back(*mid);
+          weights.push_back(local_values.size());
+        }
+      comm.allgather(medians);
+      comm.allgather(weights);
+      libmesh_assert_equal_to (medians.size(), weights.size());
+
+      std::vector<std::pair<T, largest_id_type>> nominations;
+      for (auto i : index_range(medians))
+        nominations.emplace_back(medians[i], weights[i]);
+      std::sort(nominations.begin(), nominations.end(),
+                [](const std::pair<T, largest_id_type> & a,
+                   const std::pair<T, largest_id_type> & b)
+                { return a.first < b.first; });
+
+      largest_id_type weight_below = 0;
+      auto nomination = nominations.begin();
+      for (; 2*(weight_below + nomination->second) < n_remaining; ++nomination)
+        weight_below += nomination->second;
+      const T pivot = nomination->first;
+
+      // Split our values into those below, equal to and above the pivot
+      const auto less_end =
+        std::partition(local_values.begin(), local_values.end(),
+                       [&pivot](const T & v) { return v < pivot; });
+      const auto equal_end =
+        std::partition(less_end, local_values.end(),
+                       [&pivot](const T & v) { return !(pivot < v); });
+
+      std::vector<largest_id_type> counts
+        {largest_id_type(less_end - local_values.begin()),
+         largest_id_type(equal_end - less_end)};
+      comm.sum(counts);
+
+      if (n < counts[0])
+        {
+          local_values.erase(less_end, local_values.end());
+          n_remaining = counts[0];
+        }
+      else if (n < counts[0] + counts[1])
+        return pivot;
+      else
+        {
+          local_values.erase(local_values.begin(), equal_end);
+          n -= counts[0] + counts[1];
+          n_remaining -= counts[0] + counts[1];
+        }
+    }
+
+  comm.allgather(local_values);
+  libmesh_assert_less (n, local_values.size());
+  std::nth_element(local_values.begin(), local_values.begin() + n,
+                   local_values.end());
+  return local_values[n];
+}
+
+} // namespace Parallel
+
+} // namespace libMesh
+
+#endif // LIBMESH_PARALLEL_NTH_ELEMENT_H
@@ -55,13 +55,52 @@ template <typename KeyType, typename IdxType=unsigned int>
 class Sort : public ParallelObject
 {
 public:
+  /**
+   * The algorithms available for distributing the keys between
+   * processors.
+   */
+  enum Method
+    {
+      /**
+       * Bin the keys uniformly between the global min and max key,
+       * refining the bins with a parallel histogram.
+       */
+      BIN_SORT,
+
+      /**
+       * Sort by regular sampling: each processor contributes evenly
+       * spaced samples of its sorted keys, and every processor picks
+       * the same splitters from the gathered samples, so the keys are
+       * exchanged after a single allgather.
+       */
+      SAMPLE_SORT
+    };
+
+  /**
+   * The algorithms available for sorting the keys on each processor.
+   */
+  enum LocalMethod
+    {
+      /**
+       * Comparison sort with std::sort.
+       */
+      STD_SORT,
+
+      /**
+       * LSD radix sort.  Only implemented for Hilbert index keys;
+       * other key types use std::sort regardless.
+       */
+      RADIX_SORT
+    };
+
   /**
    * Constructor takes the number of processors,
    * the processor id, and a reference to a vector of data
-   * to be sorted.  This vector is sorted by
-   * the constructor, therefore, construction of
-   * a Sort object takes O(n log n) time,
-   * where n is the length of the vector.
+   * to be sorted.  This vector is sorted in place by sort().
+   *
+   * The methods used default to BIN_SORT and STD_SORT, or to
+   * whatever is given on the command line with
+   * "--parallel-sort=bin|sample" and "--parallel-sort-local=std|radix".
    */
   Sort (const Parallel::Communicator & comm,
         std::vector<KeyType> & d);
@@ -75,6 +114,17 @@ public:
    */
   void sort();
 
+  /**
+   * Sets the algorithm used to distribute keys between processors.
+   * Must be the same on every processor.
+   */
+  void set_method (Method method) { _method = method; }
+
+  /**
+   * Sets the algorithm used to sort keys on each processor.
+   */
+  void set_local_method (LocalMethod method) { _local_method = method; }
+
   /**
    * Return a constant reference to _my_bin.  This allows
    * us to do things like check if sorting was successful
@@ -99,6 +149,16 @@ private:
    */
   bool _bin_is_sorted;
 
+  /**
+   * The algorithm used to distribute keys between processors.
+   */
+  Method _method;
+
+  /**
+   * The algorithm used to sort keys on each processor.
+   */
+  LocalMethod _local_method;
+
   /**
    * The raw, unsorted data which will need to
    * be sorted (in parallel) across all
@@ -122,12 +182,22 @@ private:
   std::vector<KeyType> _my_bin;
 
   /**
-   * Sorts the local data into bins across all processors.
-   * Right now it constructs a BinSorter<KeyType> object.
-   * In the future this could be a template parameter.
+   * Sorts the local data into bins across all processors, for
+   * BIN_SORT.  Right now it constructs a BinSorter<KeyType> object.
    */
   void binsort ();
 
+  /**
+   * Finds the bins of the local data for SAMPLE_SORT, from splitters
+   * chosen among regular samples of every processor's sorted data.
+   */
+  void sample_sort ();
+
+  /**
+   * Sorts \p keys with the local sort method.
+   */
+  void sort_local (std::vector<KeyType> & keys);
+
   /**
    * Communicates the bins from each processor to the
    * appropriate processor.  By the time this function
@@ -138,8 +208,7 @@ private:
 
   /**
    * After all the bins have been communicated, we can
-   * sort our local bin.  This is nothing more than a
-   * call to std::sort
+   * sort our local bin.
    */
   void sort_local_bin();
 
@@ -0,0 +1,185 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_TASK_GRAPH_H
+#define LIBMESH_TASK_GRAPH_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <vector>
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+# include <condition_variable>
+# include <mutex>
+# include <thread>
+#endif
+
+namespace libMesh
+{
+
+namespace Threads
+{
+
+/**
+ * A set of tasks with dependencies between them, run asynchronously
+ * on a few worker threads owned by the graph, so that independent
+ * phases of a computation can overlap: e.g. writing the output of one
+ * timestep while the caller assembles the next.
+ *
+ * Each task is added with the ids of tasks it depends on, and is run
+ * once all of them have finished.  The caller carries on meanwhile,
+ * and can wait() for any task or for all of them.  If a task throws,
+ * its exception is stored and rethrown by wait(), and every task
+ * depending on it is skipped and fails with the same exception.
+ *
+ * Tasks run concurrently with the caller and with each other, so all
+ * the usual thread safety considerations apply to anything they
+ * touch.  In particular:
+ * - Threads::parallel_for() and parallel_reduce() must only be used by
+ *   one thread at a time, whether that's the caller or a task.
+ * - The PerfLog only supports logging from inside threaded loops,
+ *   so tasks should not log events while the caller does.
+ * - Tasks doing MPI communication need an MPI library initialized
+ *   with MPI_THREAD_MULTIPLE support, and a Communicator of their
+ *   own, since other communication may be in progress at the same time.
+ * - A task must not wait() on its own graph.
+ *
+ * With no worker threads, or without std::thread support, each task is
+ * instead run when it is added; since its dependencies were added
+ * before it, they will already have run.
+ */
+class TaskGraph
+{
+public:
+  /**
+   * Identifies a task within its graph.
+   */
+  typedef std::size_t task_id;
+
+  /**
+   * Constructor.  Starts \p n_workers threads to run the tasks on.
+   * One is enough to overlap a single background task with the
+   * caller's work.
+   */
+  explicit TaskGraph (unsigned int n_workers = 1);
+
+  /**
+   * Waits for every task to finish, ignoring any exceptions they
+   * throw, and stops the worker threads.
+   */
+  ~TaskGraph ();
+
+  TaskGraph (const TaskGraph &) = delete;
+  TaskGraph & operator= (const TaskGraph &) = delete;
+
+  /**
+   * Adds a task which runs \p work once each task in \p dependencies
+   * has finished.
+   *
+   * \returns The id of the new task, to wait() on or to use as a
+   * dependency of later tasks.
+   */
+  task_id add_task (std::function<void ()> work,
+                    const std::vector<task_id> & dependencies = {});
+
+  /**
+   * Blocks until task \p id has finished, and rethrows its exception
+   * if it threw one.
+   */
+  void wait (task_id id);
+
+  /**
+   * Blocks until every task added so far has finished, and rethrows
+   * the exception of the first failed task, if any.
+   */
+  void wait_all ();
+
+  /**
+   * \returns \p true if task \p id has finished, successfully or not.
+   */
+  bool finished (task_id id) const;
+
+  /**
+   * \returns The number of tasks added so far.
+   */
+  std::size_t n_tasks () const;
+
+  /**
+   * \returns The number of worker threads running the tasks.
+   */
+  unsigned int n_workers () const;
+
+private:
+  struct Task
+  {
+    std::function<void ()> work;
+    std::vector<task_id> dependents;
+    unsigned int n_unfinished_dependencies = 0;
+    bool finished = false;
+    std::exception_ptr exception;
+  };
+
+  /**
+   * Runs \p id, which must be ready, and marks it finished.  The lock,
+   * if any, is held on entry and on return, but not while the task
+   * runs.
+   */
+  template <typename Lock>
+  void run_task (task_id id, Lock & lock);
+
+  /**
+   * Marks \p id finished, and queues any dependents which become
+   * ready, skipping them if \p id failed.
+   */
+  void finish_task (task_id id);
+
+  /**
+   * The loop run by each worker thread.
+   */
+  void worker_loop ();
+
+  std::deque<Task> _tasks;
+
+  /**
+   * Tasks whose dependencies have all finished, in the order they
+   * became ready.
+   */
+  std::deque<task_id> _ready;
+
+  std::size_t _n_finished;
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+  mutable std::mutex _mutex;
+  std::condition_variable _task_ready;
+  std::condition_variable _task_finished;
+  std::vector<std::thread> _workers;
+  bool _shutting_down;
+#endif
+};
+
+} // namespace Threads
+
+} // namespace libMesh
+
+#endif // LIBMESH_TASK_GRAPH_H
@@ -122,6 +122,8 @@ public:
 #define LIBMESH_SQUASH_HEADER_WARNING
 #ifdef LIBMESH_HAVE_TBB_API
 # include "libmesh/threads_tbb.h"
+#elif defined(LIBMESH_HAVE_PTHREAD) && defined(LIBMESH_HAVE_OPENMP)
+# include "libmesh/threads_openmp.h"
 #elif LIBMESH_HAVE_PTHREAD
 # include "libmesh/threads_pthread.h"
 #else
@@ -0,0 +1,414 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_THREADS_OPENMP_H
+#define LIBMESH_THREADS_OPENMP_H
+
+// Do not try to #include this header directly, it is designed to be
+// #included directly by threads.h
+#ifndef LIBMESH_SQUASH_HEADER_WARNING
+# warning "This file is designed to be included through libmesh/threads.h"
+#else
+
+#if defined(LIBMESH_HAVE_PTHREAD) && defined(LIBMESH_HAVE_OPENMP)
+
+// C++ includes
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+# include <thread>
+#endif
+
+#include <omp.h>
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <vector>
+
+// Thread-Local-Storage macros
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+#  define LIBMESH_TLS_TYPE(type)  thread_local type
+#  define LIBMESH_TLS_REF(value)  (value)
+#else
+#  define LIBMESH_TLS_TYPE(type)  type
+#  define LIBMESH_TLS_REF(value)  (value)
+#endif
+
+namespace libMesh
+{
+
+namespace Threads
+{
+
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+/**
+ * Use std::thread when available.
+ */
+typedef std::thread Thread;
+
+#else
+
+/**
+ * Use the non-concurrent placeholder.
+ */
+typedef NonConcurrentThread Thread;
+
+#endif // LIBMESH_HAVE_CXX11_THREAD
+
+
+/**
+ * Spin mutex.  Implemented with an OpenMP lock, so waiting threads
+ * follow the OpenMP runtime's wait policy (OMP_WAIT_POLICY).
+ */
+class spin_mutex
+{
+public:
+  spin_mutex() { omp_init_lock(&slock); }
+  ~spin_mutex() { omp_destroy_lock(&slock); }
+
+  void lock () { omp_set_lock(&slock); }
+  void unlock () { omp_unset_lock(&slock); }
+
+  class scoped_lock
+  {
+  public:
+    scoped_lock () : smutex(nullptr) {}
+    explicit scoped_lock ( spin_mutex & in_smutex ) : smutex(&in_smutex) { smutex->lock(); }
+
+    ~scoped_lock () { release(); }
+
+    void acquire ( spin_mutex & in_smutex ) { smutex = &in_smutex; smutex->lock(); }
+    void release () { if (smutex) smutex->unlock(); smutex = nullptr; }
+
+  private:
+    spin_mutex * smutex;
+  };
+
+private:
+  omp_lock_t slock;
+};
+
+
+
+/**
+ * Recursive mutex.  Implemented with an OpenMP nestable lock.
+ */
+class recursive_mutex
+{
+public:
+  recursive_mutex() { omp_init_nest_lock(&rlock); }
+  ~recursive_mutex() { omp_destroy_nest_lock(&rlock); }
+
+  void lock () { omp_set_nest_lock(&rlock); }
+  void unlock () { omp_unset_nest_lock(&rlock); }
+
+  class scoped_lock
+  {
+  public:
+    scoped_lock () : rmutex(nullptr) {}
+    explicit scoped_lock ( recursive_mutex & in_rmutex ) : rmutex(&in_rmutex) { rmutex->lock(); }
+
+    ~scoped_lock () { release(); }
+
+    void acquire ( recursive_mutex & in_rmutex ) { rmutex = &in_rmutex; rmutex->lock(); }
+    void release () { if (rmutex) rmutex->unlock(); rmutex = nullptr; }
+
+  private:
+    recursive_mutex * rmutex;
+  };
+
+private:
+  omp_nest_lock_t rlock;
+};
+
+
+
+/**
+ * Scheduler to manage threads.  The threads themselves belong to the
+ * OpenMP runtime; all we can do is tell it how many to use.
+ */
+class task_scheduler_init
+{
+public:
+  static const int automatic = -1;
+  explicit task_scheduler_init (int n_threads = automatic) { initialize(n_threads); }
+  void initialize (int n_threads = automatic) { if (n_threads > 0) omp_set_num_threads(n_threads); }
+  void terminate () {}
+};
+
+
+
+//-------------------------------------------------------------------
+/**
+ * Dummy "splitting object" used to distinguish splitting constructors
+ * from copy constructors.
+ */
+class split {};
+
+
+
+/**
+ * Splits \p range with its splitting constructor for as long as
+ * Range::is_divisible() allows, so that the range's grainsize is
+ * honored, and appends the pieces to \p chunks in order.
+ */
+template <typename Range>
+void split_into_chunks (std::unique_ptr<Range> range,
+                        std::vector<std::unique_ptr<Range>> & chunks)
+{
+  if (!range->is_divisible())
+    {
+      chunks.push_back(std::move(range));
+      return;
+    }
+
+  auto second_half = std::make_unique<Range>(*range, Threads::split());
+  split_into_chunks(std::move(range), chunks);
+  split_into_chunks(std::move(second_half), chunks);
+}
+
+
+
+/**
+ * Runs \p run_chunk(thread, chunk) on each chunk of \p range in an
+ * OpenMP parallel region, handing the chunks out dynamically so that
+ * threads which finish early pick up more work.  \p thread is the
+ * OpenMP thread number running the chunk.
+ *
+ * Exceptions can't propagate out of a parallel region, so the first
+ * one thrown by any chunk is rethrown here, after the region ends;
+ * chunks which haven't started by then are skipped.
+ */
+template <typename Range, typename RunChunk>
+void run_chunks (const Range & range,
+                 const RunChunk & run_chunk)
+{
+  std::vector<std::unique_ptr<Range>> chunks;
+  split_into_chunks(std::make_unique<Range>(range), chunks);
+
+  const int n_chunks = cast_int<int>(chunks.size());
+  const int n_threads =
+    std::min(cast_int<int>(libMesh::n_threads()), n_chunks);
+
+  std::exception_ptr exception;
+  bool aborted = false;
+
+  // The use of 'int' instead of unsigned for the iteration variable
+  // is deliberate here.  This is an OpenMP loop, and some older
+  // compilers warn when you don't use int for the loop index.
+#pragma omp parallel for schedule (dynamic) num_threads (n_threads)
+  for (int i=0; i<n_chunks; i++)
+    {
+      bool skip;
+#pragma omp atomic read
+      skip = aborted;
+
+      if (skip)
+        continue;
+
+      try
+        {
+          run_chunk(omp_get_thread_num(), *chunks[i]);
+        }
+      catch (...)
+        {
+#pragma omp critical (libmesh_threads_exception)
+          if (!exception)
+            exception = std::current_exception();
+
+#pragma omp atomic write
+          aborted = true;
+        }
+    }
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+
+
+//-------------------------------------------------------------------
+/**
+ * Execute the provided function object in parallel on the specified
+ * range.
+ */
+template <typename Range, typename Body>
+inline
+void parallel_for (const Range & range, const Body & body)
+{
+  Threads::BoolAcquire b(Threads::in_threads);
+
+  // If we're running in serial, or there's nothing to split - just run!
+  if (libMesh::n_threads() == 1 || !range.is_divisible())
+  {
+    body(range);
+    return;
+  }
+
+  DisablePerfLogInScope disable_perf;
+
+  run_chunks(range,
+             [&body](int, const Range & chunk)
+             { body(chunk); });
+}
+
+/**
+ * Execute the provided function object in parallel on the specified
+ * range with the specified partitioner.
+ */
+template <typename Range, typename Body, typename Partitioner>
+inline
+void parallel_for (const Range & range, const Body & body, const Partitioner &)
+{
+  parallel_for (range, body);
+}
+
+/**
+ * Execute the provided reduction operation in parallel on the specified
+ * range.
+ */
+template <typename Range, typename Body>
+inline
+void parallel_reduce (const Range & range, Body & body)
+{
+  Threads::BoolAcquire b(Threads::in_threads);
+
+  // If we're running in serial, or there's nothing to split - just run!
+  if (libMesh::n_threads() == 1 || !range.is_divisible())
+  {
+    body(range);
+    return;
+  }
+
+  DisablePerfLogInScope disable_perf;
+
+  const unsigned int n_threads = libMesh::n_threads();
+
+  // Create copies of the body for each OpenMP thread, before any of
+  // them start running
+  std::vector<std::unique_ptr<Body>> split_bodies;
+  std::vector<Body *> bodies(n_threads);
+  bodies[0] = &body; // Use the original body for the first one
+  for (unsigned int i=1; i<n_threads; i++)
+    {
+      split_bodies.push_back(std::make_unique<Body>(body, Threads::split()));
+      bodies[i] = split_bodies.back().get();
+    }
+
+  run_chunks(range,
+             [&bodies](int thread, const Range & chunk)
+             { (*bodies[thread])(chunk); });
+
+  // Join them all down to the original Body
+  for (unsigned int i=n_threads-1; i != 0; i--)
+    bodies[i-1]->join(*bodies[i]);
+}
+
+/**
+ * Execute the provided reduction operation in parallel on the specified
+ * range with the specified partitioner.
+ */
+template <typename Range, typename Body, typename Partitioner>
+inline
+void parallel_reduce (const Range & range, Body & body, const Partitioner &)
+{
+  parallel_reduce(range, body);
+}
+
+
+/**
+ * Defines atomic operations which can only be executed on a
+ * single thread at a time.
+ */
+template <typename T>
+class atomic
+{
+public:
+  atomic () : val(0) {}
+  operator T () { return val; }
+
+  T operator=( T value )
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val = value;
+    return val;
+  }
+
+  atomic<T> & operator=( const atomic<T> & value )
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val = value;
+    return *this;
+  }
+
+
+  T operator+=(T value)
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val += value;
+    return val;
+  }
+
+  T operator-=(T value)
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val -= value;
+    return val;
+  }
+
+  T operator++()
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val++;
+    return val;
+  }
+
+  T operator++(int)
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val++;
+    return val;
+  }
+
+  T operator--()
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val--;
+    return val;
+  }
+
+  T operator--(int)
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val--;
+    return val;
+  }
+
+private:
+  T val;
+  spin_mutex smutex;
+};
+
+} // namespace Threads
+
+} // namespace libMesh
+
+#endif // #if defined(LIBMESH_HAVE_PTHREAD) && defined(LIBMESH_HAVE_OPENMP)
+
+#endif // LIBMESH_SQUASH_HEADER_WARNING
+
+#endif // LIBMESH_THREADS_OPENMP_H
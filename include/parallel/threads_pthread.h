@@ -24,10 +24,14 @@
 # warning "This file is designed to be included through libmesh/threads.h"
 #else
 
-#ifdef LIBMESH_HAVE_PTHREAD
+#if defined(LIBMESH_HAVE_PTHREAD) && !defined(LIBMESH_HAVE_OPENMP)
 
 // C++ includes
 #ifdef LIBMESH_HAVE_CXX11_THREAD
+# include <atomic>
+# include <deque>
+# include <functional>
+# include <memory>
 # include <thread>
 #endif
 
@@ -259,6 +263,196 @@ class split {};
 
 
 
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+
+/**
+ * A persistent pool of worker threads, started on first use and
+ * shut down at exit, which parallel_for() and parallel_reduce() hand
+ * their work to rather than creating new threads on every call.
+ */
+class ThreadPool
+{
+public:
+  /**
+   * Calls \p work(i) concurrently for each i in [0, \p n_workers),
+   * with work(0) on the calling thread, and returns once every call
+   * has returned.  The first exception thrown by any of the calls is
+   * rethrown here.
+   *
+   * If the pool is already busy, on a nested or concurrent call, only
+   * work(0) is called, so \p work must be able to finish the whole
+   * job on any nonempty subset of the workers.
+   */
+  static void run (unsigned int n_workers,
+                   const std::function<void (unsigned int)> & work);
+};
+
+
+
+/**
+ * Runs \p run_chunk(worker, chunk) on chunks of \p range which
+ * together cover it exactly once, using \p n_workers threads from
+ * the ThreadPool.
+ *
+ * Each worker keeps a deque of chunks.  It repeatedly halves the
+ * chunk it is working on with the splitting constructor, for as long
+ * as Range::is_divisible() allows (so a range's grainsize is
+ * honored), pushing the second halves onto the back of its own deque.
+ * It runs what's left, then takes the most recent chunk back off its
+ * deque; when its own deque is empty it steals the oldest, and so the
+ * largest, chunk from the front of another worker's.
+ */
+template <typename Range, typename RunChunk>
+void run_work_stealing (const Range & range,
+                        unsigned int n_workers,
+                        const RunChunk & run_chunk)
+{
+  struct ChunkQueue
+  {
+    spin_mutex mutex;
+    std::deque<std::unique_ptr<Range>> chunks;
+  };
+
+  std::vector<ChunkQueue> queues(n_workers);
+  queues[0].chunks.push_back(std::make_unique<Range>(range));
+
+  // The number of chunks queued or running; we're done when every
+  // chunk has run
+  std::atomic<std::size_t> n_pending(1);
+
+  // Set if a chunk throws, so the other workers give up
+  std::atomic<bool> aborted(false);
+
+  ThreadPool::run
+    (n_workers,
+     [&queues, &n_pending, &aborted, &run_chunk, n_workers]
+     (unsigned int worker)
+     {
+       while (n_pending.load() && !aborted.load())
+         {
+           std::unique_ptr<Range> chunk;
+
+           for (unsigned int i=0; i != n_workers && !chunk; i++)
+             {
+               ChunkQueue & queue = queues[(worker + i) % n_workers];
+               spin_mutex::scoped_lock lock(queue.mutex);
+               if (queue.chunks.empty())
+                 continue;
+
+               if (i == 0)
+                 {
+                   chunk = std::move(queue.chunks.back());
+                   queue.chunks.pop_back();
+                 }
+               else
+                 {
+                   chunk = std::move(queue.chunks.front());
+                   queue.chunks.pop_front();
+                 }
+             }
+
+           // Everything left is already being run by someone else
+           if (!chunk)
+             {
+               std::this_thread::yield();
+               continue;
+             }
+
+           while (chunk->is_divisible())
+             {
+               auto second_half = std::make_unique<Range>(*chunk, Threads::split());
+               ++n_pending;
+
+               ChunkQueue & queue = queues[worker];
+               spin_mutex::scoped_lock lock(queue.mutex);
+               queue.chunks.push_back(std::move(second_half));
+             }
+
+           try
+             {
+               run_chunk(worker, *chunk);
+             }
+           catch (...)
+             {
+               aborted = true;
+               throw;
+             }
+
+           --n_pending;
+         }
+     });
+}
+
+
+
+//-------------------------------------------------------------------
+/**
+ * Execute the provided function object in parallel on the specified
+ * range.
+ */
+template <typename Range, typename Body>
+inline
+void parallel_for (const Range & range, const Body & body)
+{
+  Threads::BoolAcquire b(Threads::in_threads);
+
+  // If we're running in serial, or there's nothing to split - just run!
+  if (libMesh::n_threads() == 1 || !range.is_divisible())
+  {
+    body(range);
+    return;
+  }
+
+  DisablePerfLogInScope disable_perf;
+
+  run_work_stealing(range, num_pthreads(range),
+                    [&body](unsigned int, const Range & chunk)
+                    { body(chunk); });
+}
+
+/**
+ * Execute the provided reduction operation in parallel on the specified
+ * range.
+ */
+template <typename Range, typename Body>
+inline
+void parallel_reduce (const Range & range, Body & body)
+{
+  Threads::BoolAcquire b(Threads::in_threads);
+
+  // If we're running in serial, or there's nothing to split - just run!
+  if (libMesh::n_threads() == 1 || !range.is_divisible())
+  {
+    body(range);
+    return;
+  }
+
+  DisablePerfLogInScope disable_perf;
+
+  const unsigned int n_workers = num_pthreads(range);
+
+  // Create copies of the body for each worker, before any of them
+  // start running
+  std::vector<std::unique_ptr<Body>> split_bodies;
+  std::vector<Body *> bodies(n_workers);
+  bodies[0] = &body; // Use the original body for the first one
+  for (unsigned int i=1; i<n_workers; i++)
+    {
+      split_bodies.push_back(std::make_unique<Body>(body, Threads::split()));
+      bodies[i] = split_bodies.back().get();
+    }
+
+  run_work_stealing(range, n_workers,
+                    [&bodies](unsigned int worker, const Range & chunk)
+                    { (*bodies[worker])(chunk); });
+
+  // Join them all down to the original Body
+  for (unsigned int i=n_workers-1; i != 0; i--)
+    bodies[i-1]->join(*bodies[i]);
+}
+
+#else // !LIBMESH_HAVE_CXX11_THREAD
+
 //-------------------------------------------------------------------
 /**
  * Execute the provided function object in parallel on the specified
@@ -309,51 +503,19 @@ void parallel_for (const Range & range, const Body & body)
       range_bodies[i].body = &body;
     }
 
-  // Create the threads.  It may seem redundant to wrap a pragma in
-  // #ifdefs... but GCC warns about an "unknown pragma" if it
-  // encounters this line of code when -fopenmp is not passed to the
-  // compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
+  // Create the threads
   for (unsigned int i=0; i<n_threads; i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
+    pthread_create(&threads[i], nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
 
-#if !LIBMESH_HAVE_OPENMP
   // Wait for them to finish
-
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
+  for (unsigned int i=0; i<n_threads; i++)
     pthread_join(threads[i], nullptr);
-#endif
 
   // Clean up
   for (unsigned int i=0; i<n_threads; i++)
     delete ranges[i];
 }
 
-/**
- * Execute the provided function object in parallel on the specified
- * range with the specified partitioner.
- */
-template <typename Range, typename Body, typename Partitioner>
-inline
-void parallel_for (const Range & range, const Body & body, const Partitioner &)
-{
-  parallel_for (range, body);
-}
-
 /**
  * Execute the provided reduction operation in parallel on the specified
  * range.
@@ -410,33 +572,12 @@ void parallel_reduce (const Range & range, Body & body)
 
   // Create the threads
   std::vector<pthread_t> threads(n_threads);
+  for (unsigned int i=0; i<n_threads; i++)
+    pthread_create(&threads[i], nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
 
-  // It may seem redundant to wrap a pragma in #ifdefs... but GCC
-  // warns about an "unknown pragma" if it encounters this line of
-  // code when -fopenmp is not passed to the compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
-
-#if !LIBMESH_HAVE_OPENMP
   // Wait for them to finish
   for (unsigned int i=0; i<n_threads; i++)
     pthread_join(threads[i], nullptr);
-#endif
 
   // Join them all down to the original Body
   for (unsigned int i=n_threads-1; i != 0; i--)
@@ -449,6 +590,19 @@ void parallel_reduce (const Range & range, Body & body)
     delete ranges[i];
 }
 
+#endif // LIBMESH_HAVE_CXX11_THREAD
+
+/**
+ * Execute the provided function object in parallel on the specified
+ * range with the specified partitioner.
+ */
+template <typename Range, typename Body, typename Partitioner>
+inline
+void parallel_for (const Range & range, const Body & body, const Partitioner &)
+{
+  parallel_for (range, body);
+}
+
 /**
  * Execute the provided reduction operation in parallel on the specified
  * range with the specified partitioner.
@@ -538,7 +692,7 @@ private:
 
 } // namespace libMesh
 
-#endif // #ifdef LIBMESH_HAVE_PTHREAD
+#endif // #if defined(LIBMESH_HAVE_PTHREAD) && !defined(LIBMESH_HAVE_OPENMP)
 
 #endif // LIBMESH_SQUASH_HEADER_WARNING
 
@@ -0,0 +1,127 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+
+#ifndef LIBMESH_HIERARCHICAL_PARTITIONER_H
+#define LIBMESH_HIERARCHICAL_PARTITIONER_H
+
+// Local Includes
+#include "libmesh/partitioner.h"
+
+// C++ Includes
+#include <memory>
+
+namespace libMesh
+{
+
+/**
+ * The \p HierarchicalPartitioner partitions in two levels: first
+ * into groups, typically one per compute node, and then each group's
+ * elements into that group's pieces, typically one per MPI rank on
+ * the node.  Cuts between groups, where communication is expensive,
+ * are then minimized separately from cuts within a group.
+ *
+ * Group g gets pieces [g*pieces_per_group, (g+1)*pieces_per_group),
+ * which matches the usual MPI placement of consecutive ranks on the
+ * same node.  If the number of pieces isn't a multiple of
+ * pieces_per_group, the internal partitioner is used on its own.
+ *
+ * \brief Partitions across compute nodes, then within each node.
+ */
+class HierarchicalPartitioner : public Partitioner
+{
+public:
+
+  /**
+   * Constructors. The default ctor initializes the internal
+   * Partitioner object to a MetisPartitioner so the class is usable,
+   * although this type can be customized later.
+   */
+  HierarchicalPartitioner ();
+  HierarchicalPartitioner (const HierarchicalPartitioner & other);
+
+  /**
+   * This class contains a unique_ptr member, so it can't be default
+   * copy assigned.
+   */
+  HierarchicalPartitioner & operator= (const HierarchicalPartitioner &) = delete;
+
+  /**
+   * Move ctor, move assignment operator, and destructor are
+   * all explicitly defaulted for this class.
+   */
+  HierarchicalPartitioner (HierarchicalPartitioner &&) = default;
+  HierarchicalPartitioner & operator= (HierarchicalPartitioner &&) = default;
+  virtual ~HierarchicalPartitioner() = default;
+
+  virtual PartitionerType type () const override;
+
+  /**
+   * \returns A copy of this partitioner wrapped in a smart pointer.
+   */
+  virtual std::unique_ptr<Partitioner> clone () const override
+  {
+    return std::make_unique<HierarchicalPartitioner>(*this);
+  }
+
+  /**
+   * The number of pieces in each group.  The default, 0, uses the
+   * smallest number of MPI ranks sharing a compute node, as found by
+   * MPI_Comm_split_type() with MPI_COMM_TYPE_SHARED.  This may also be
+   * set by hand, e.g. to group pieces by socket.
+   */
+  unsigned int pieces_per_group;
+
+  /**
+   * Get a reference to the Partitioner used internally at both
+   * levels, which must support partition_range().
+   */
+  std::unique_ptr<Partitioner> & internal_partitioner() { return _internal_partitioner; }
+
+  /**
+   * Attaches weights to the internal partitioner.
+   */
+  virtual void attach_weights(ErrorVector * weights) override;
+
+protected:
+  /**
+   * The internal Partitioner we use. Public access via the
+   * internal_partitioner() member function.
+   */
+  std::unique_ptr<Partitioner> _internal_partitioner;
+
+  /**
+   * Partition the \p MeshBase into \p n subdomains.
+   */
+  virtual void _do_partition (MeshBase & mesh,
+                              const unsigned int n) override;
+
+private:
+
+  /**
+   * \returns pieces_per_group, or the number of ranks per compute
+   * node if that is 0.
+   */
+  unsigned int group_size (const MeshBase & mesh) const;
+};
+
+} // namespace libMesh
+
+#endif  // LIBMESH_HIERARCHICAL_PARTITIONER_H
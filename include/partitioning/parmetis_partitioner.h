@@ -83,6 +83,19 @@ public:
     return std::make_unique<ParmetisPartitioner>(*this);
   }
 
+  virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
+
+  /**
+   * Sets the ratio of inter-processor communication time to data
+   * redistribution time which ParMETIS_V3_AdaptiveRepart() balances
+   * when repartitioning an already partitioned mesh.  The default,
+   * 1e6, all but ignores redistribution cost, which amounts to
+   * partitioning from scratch.  Values of around 1 to 1000 keep most
+   * elements where they are, e.g. after adaptive refinement, at some
+   * cost in edge cut.
+   */
+  void set_itr (Real itr) { _itr = itr; }
+
 
 protected:
 
@@ -101,6 +114,11 @@ protected:
   virtual void _do_partition (MeshBase & mesh,
                               const unsigned int n) override;
 
+  /**
+   * The ParMETIS communication to redistribution time ratio.
+   */
+  Real _itr;
+
 #ifdef LIBMESH_HAVE_PARMETIS
   /**
   * Build the graph.
@@ -30,6 +30,7 @@
 #include <memory>
 #include <unordered_map>
 #include <queue>
+#include <vector>
 
 namespace libMesh
 {
@@ -55,7 +56,7 @@ public:
   /**
    * Constructor.
    */
-  Partitioner () : _weights(nullptr) {}
+  Partitioner () : _weights(nullptr), _compute_stats(false), _stats_serial(false) {}
 
   /**
    * Copy/move ctor, copy/move assignment operator, and destructor are
@@ -186,6 +187,12 @@ public:
    */
   static void processor_pairs_to_interface_nodes(MeshBase & mesh, std::map<std::pair<processor_id_type, processor_id_type>, std::set<dof_id_type>> & processor_pair_to_nodes);
 
+  /**
+   * The same, storing the nodes of each interface as a sorted vector
+   * of unique ids, which is cheaper to build and to search than a set.
+   */
+  static void processor_pairs_to_interface_nodes(MeshBase & mesh, std::map<std::pair<processor_id_type, processor_id_type>, std::vector<dof_id_type>> & processor_pair_to_nodes);
+
   /**
   * Nodes on the partitioning interface is linearly assigned to
   * each pair of processors
@@ -208,10 +215,56 @@ public:
   /**
    * Attach weights that can be used for partitioning.  This ErrorVector should be
    * _exactly_ the same on every processor and should have mesh->max_elem_id()
-   * entries.
+   * entries.  The Metis and Parmetis partitioners truncate weights to integers,
+   * so they should be scaled accordingly; FEMSystem::elem_assembly_weights()
+   * builds suitable weights from measured assembly times.  The vector is not
+   * copied, so it must outlive any partitioning done while it is attached.
    */
   virtual void attach_weights(ErrorVector * /*weights*/) { libmesh_not_implemented(); }
 
+  /**
+   * Load balance and data migration of a partitioning.
+   */
+  struct PartitionStats
+  {
+    /**
+     * The largest piece's load over the mean load, before and after
+     * partitioning.  Load is the sum of attached weights, or the
+     * number of active elements without weights.
+     */
+    Real imbalance_before = 0;
+    Real imbalance_after = 0;
+
+    /**
+     * The number of active elements whose processor id changed.
+     */
+    dof_id_type n_migrated_elem = 0;
+
+    /**
+     * The number of active elements partitioned.
+     */
+    dof_id_type n_active_elem = 0;
+  };
+
+  /**
+   * If \p compute is true, partition() and repartition() record
+   * partition_stats(), at the cost of an extra pass over the active
+   * elements and a few reductions.  Default false.
+   */
+  void compute_partition_stats (bool compute) { _compute_stats = compute; }
+
+  /**
+   * \returns The statistics recorded by the most recent partition()
+   * or repartition() into more than one piece, when
+   * compute_partition_stats() is enabled.
+   */
+  const PartitionStats & partition_stats () const { return _stats; }
+
+  /**
+   * Prints partition_stats() to \p os.
+   */
+  void print_partition_stats (std::ostream & os = libMesh::out) const;
+
 protected:
 
   /**
@@ -303,6 +356,48 @@ protected:
 
 
   std::vector<Elem *> _local_id_to_elem;
+
+private:
+
+  /**
+   * Computes the active element loads of the pieces of \p mesh,
+   * counting each element once, summed over all processors.  If
+   * elements have been assigned new processor ids but not yet
+   * redistributed, \p old_pids gives the ids they had before.
+   */
+  std::vector<Real> piece_loads (const MeshBase & mesh,
+                                 unsigned int n_parts,
+                                 const std::unordered_map<dof_id_type, processor_id_type> * old_pids) const;
+
+  /**
+   * Records the current imbalance and element processor ids, before
+   * partitioning into \p n_parts pieces.
+   */
+  void start_partition_stats (const MeshBase & mesh,
+                              unsigned int n_parts,
+                              std::unordered_map<dof_id_type, processor_id_type> & old_pids);
+
+  /**
+   * Records the imbalance and migration of the new partitioning.
+   */
+  void finish_partition_stats (const MeshBase & mesh,
+                               unsigned int n_parts,
+                               const std::unordered_map<dof_id_type, processor_id_type> & old_pids);
+
+  /**
+   * Whether to compute \p _stats.
+   */
+  bool _compute_stats;
+
+  /**
+   * Statistics from the most recent partitioning.
+   */
+  PartitionStats _stats;
+
+  /**
+   * Whether the mesh was serial when we started computing \p _stats.
+   */
+  bool _stats_serial;
 };
 
 } // namespace libMesh
@@ -34,6 +34,10 @@ namespace libMesh
  * The \p SFCPartitioner uses a Hilbert or Morton-ordered space
  * filling curve to partition the elements.
  *
+ * A distributed mesh is partitioned along a Hilbert curve without
+ * being serialized, by sorting the elements' Hilbert keys in
+ * parallel, when libMesh is built with libHilbert and MPI.
+ *
  * \author Benjamin S. Kirk
  * \date 2003
  * \brief Partitioner based on different types of space filling curves.
@@ -82,6 +86,12 @@ public:
     _sfc_type = std::move(sfc_type);
   }
 
+  /**
+   * With weights attached, the curve is cut into pieces of equal
+   * total weight rather than equal numbers of elements.
+   */
+  virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
+
   /**
    * Called by the SubdomainPartitioner to partition elements in the range (it, end).
    */
@@ -98,6 +108,15 @@ protected:
   virtual void _do_partition (MeshBase & mesh,
                               const unsigned int n) override;
 
+#if defined(LIBMESH_HAVE_LIBHILBERT) && defined(LIBMESH_HAVE_MPI)
+  /**
+   * Partitions a distributed mesh into \p n pieces along a Hilbert
+   * curve, with each processor only handling its local elements.
+   */
+  void _do_distributed_partition (MeshBase & mesh,
+                                  const unsigned int n);
+#endif
+
 
 private:
 
@@ -332,6 +332,20 @@ protected:
   virtual void init_3D (const ElemType type=INVALID_ELEM,
                         unsigned int p_level=0);
 
+  /**
+   * \returns \p true if the points and weights computed by init()
+   * depend only on the class of this rule, its type(), dimension and
+   * order, the element type and p-level, and the options in this base
+   * class.  In that case init() computes each distinct rule only once
+   * and caches it, which saves time when the element type or p-level
+   * changes frequently, e.g. on mixed-element or p-refined meshes.
+   *
+   * The default implementation returns \p false, so that derived
+   * classes with additional state affecting their rules are never
+   * cached incorrectly.
+   */
+  virtual bool rules_are_cacheable() const { return false; }
+
   /**
    * Constructs a 2D rule from the tensor product of \p q1D with
    * itself.  Used in the \p init_2D() routines for quadrilateral
@@ -68,6 +68,8 @@ private:
   virtual void init_1D (const ElemType, unsigned int) override;
   virtual void init_2D (const ElemType, unsigned int) override;
   virtual void init_3D (const ElemType, unsigned int) override;
+
+  virtual bool rules_are_cacheable() const override { return true; }
 };
 
 } // namespace libMesh
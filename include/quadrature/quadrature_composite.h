@@ -89,6 +89,9 @@ public:
   /**
    * Overrides the base class init() function, and uses the ElemCutter to
    * subdivide the element into "inside" and "outside" subelements.
+   * Each QComposite has its own ElemCutter, so separate QComposite
+   * objects may be used concurrently on simplices, which are cut
+   * without calling a mesh generator.
    */
   virtual void init (const Elem & elem,
                      const std::vector<Real> & vertex_distance_func,
@@ -102,6 +105,13 @@ private:
    */
   void add_subelem_values (const std::vector<Elem const *> & subelem);
 
+  /**
+   * Helper function called from init() to collect all the points and
+   * weights of the subelement quadrature rules on the simplices of a
+   * cut simplex.
+   */
+  void add_subsimplex_values (const std::vector<std::vector<Point>> & simplices);
+
   /**
    * Subcell quadrature object.
    */
@@ -80,6 +80,8 @@ private:
   virtual void init_2D (const ElemType, unsigned int) override;
   virtual void init_3D (const ElemType, unsigned int) override;
 
+  virtual bool rules_are_cacheable() const override { return true; }
+
   /**
    * Implementation of conical product rule for a Tri in 2D of
    * order get_order().
@@ -80,6 +80,8 @@ private:
   virtual void init_2D (const ElemType, unsigned int) override;
   virtual void init_3D (const ElemType, unsigned int) override;
 
+  virtual bool rules_are_cacheable() const override { return true; }
+
   /**
    * The Dunavant rules are for triangles. This function takes
    * permutation points and weights in a specific format as input and
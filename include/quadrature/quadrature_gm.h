@@ -133,6 +133,8 @@ private:
   virtual void init_2D (const ElemType, unsigned int) override;
   virtual void init_3D (const ElemType, unsigned int) override;
 
+  virtual bool rules_are_cacheable() const override { return true; }
+
   /**
    * This routine is called from init_2D() and init_3D().  It actually
    * fills the _points and _weights vectors for a given rule index, s
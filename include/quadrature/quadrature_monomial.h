@@ -94,6 +94,8 @@ private:
   virtual void init_2D (const ElemType, unsigned int) override;
   virtual void init_3D (const ElemType, unsigned int) override;
 
+  virtual bool rules_are_cacheable() const override { return true; }
+
   /**
    * Wissmann published three interesting "partially symmetric" rules
    * for integrating degree 4, 6, and 8 polynomials exactly on QUADs.
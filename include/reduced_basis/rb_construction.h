@@ -233,6 +233,26 @@ public:
   {this->normalize_rb_bound_in_greedy = normalize_rb_bound_in_greedy_in; }
   bool get_normalize_rb_bound_in_greedy() const { return normalize_rb_bound_in_greedy; }
 
+  /**
+   * Get/set the boolean to indicate if compute_max_error_bound()
+   * evaluates the training set error bounds with a single threaded
+   * RBEvaluation::rb_solve_batch() call instead of calling
+   * get_RB_error_bound() on each training sample.  Overrides of
+   * get_RB_error_bound() are not used in that case.
+   */
+  void set_batch_training_error_bounds(bool batch_training_error_bounds_in)
+  {this->batch_training_error_bounds = batch_training_error_bounds_in; }
+  bool get_batch_training_error_bounds() const { return batch_training_error_bounds; }
+
+  /**
+   * Get/set the boolean to indicate if compute_max_error_bound()
+   * splits a serial training set between processors, rather than
+   * having every processor evaluate every training sample.
+   */
+  void set_shard_serial_training_set(bool shard_serial_training_set_in)
+  {this->shard_serial_training_set = shard_serial_training_set_in; }
+  bool get_shard_serial_training_set() const { return shard_serial_training_set; }
+
   /**
    * Get/set the string that determines the training type.
    */
@@ -786,6 +806,13 @@ protected:
    */
   virtual Real get_RB_error_bound();
 
+  /**
+   * Normalize \p error_bound by \p normalization, as done in the
+   * greedy when normalize_rb_bound_in_greedy is true.  Bounds and
+   * normalizations below abs_training_tolerance are not normalized.
+   */
+  Real normalize_error_bound(Real error_bound, Real normalization) const;
+
   /**
    * Compute the reduced basis matrices for the current basis.
    */
@@ -954,6 +981,18 @@ private:
    */
   bool normalize_rb_bound_in_greedy;
 
+  /**
+   * This boolean indicates if compute_max_error_bound() uses
+   * RBEvaluation::rb_solve_batch() on the local training samples.
+   */
+  bool batch_training_error_bounds;
+
+  /**
+   * This boolean indicates if compute_max_error_bound() splits a
+   * serial training set between processors.
+   */
+  bool shard_serial_training_set;
+
   /**
    * This string indicates the type of training that we will use.
    * Options are:
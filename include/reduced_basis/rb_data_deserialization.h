@@ -80,9 +80,14 @@ public:
   virtual ~RBEvaluationDeserialization();
 
   /**
-   * Write the Cap'n'Proto buffer to disk.
+   * Read the Cap'n'Proto buffer from disk.  If \p use_mmap is true,
+   * and the platform supports it, the buffer is read from a
+   * read-only memory mapping of the file instead of being streamed
+   * into a heap buffer first.
    */
-  void read_from_file(const std::string & path, bool read_error_bound_data);
+  void read_from_file(const std::string & path,
+                      bool read_error_bound_data,
+                      bool use_mmap = false);
 
 private:
 
@@ -121,9 +126,12 @@ public:
   virtual ~TransientRBEvaluationDeserialization();
 
   /**
-   * Write the Cap'n'Proto buffer to disk.
+   * Read the Cap'n'Proto buffer from disk, optionally from a memory
+   * mapping of the file as in RBEvaluationDeserialization.
    */
-  void read_from_file(const std::string & path, bool read_error_bound_data);
+  void read_from_file(const std::string & path,
+                      bool read_error_bound_data,
+                      bool use_mmap = false);
 
 private:
 
@@ -162,9 +170,10 @@ public:
   virtual ~RBEIMEvaluationDeserialization();
 
   /**
-   * Write the Cap'n'Proto buffer to disk.
+   * Read the Cap'n'Proto buffer from disk, optionally from a memory
+   * mapping of the file as in RBEvaluationDeserialization.
    */
-  void read_from_file(const std::string & path);
+  void read_from_file(const std::string & path, bool use_mmap = false);
 
 private:
 
@@ -207,9 +216,10 @@ public:
   virtual ~RBSCMEvaluationDeserialization();
 
   /**
-   * Write the Cap'n'Proto buffer to disk.
+   * Read the Cap'n'Proto buffer from disk, optionally from a memory
+   * mapping of the file as in RBEvaluationDeserialization.
    */
-  void read_from_file(const std::string & path);
+  void read_from_file(const std::string & path, bool use_mmap = false);
 
 private:
 
@@ -172,6 +172,28 @@ public:
    */
   virtual Real train_eim_approximation_with_POD();
 
+  /**
+   * Specify whether train_eim_approximation_with_POD() should compute
+   * the dominant POD modes with a randomized eigensolver instead of
+   * forming and decomposing the full correlation matrix of the training
+   * snapshots. The randomized approach only requires products of the
+   * correlation matrix with a few vectors, so its cost and memory use
+   * scale linearly, rather than quadratically, in the number of training
+   * samples. This can also be enabled by setting the best fit type to
+   * "randomized_pod".
+   */
+  void set_use_randomized_POD(bool use_randomized_POD);
+  bool get_use_randomized_POD() const;
+
+  /**
+   * Set the number of extra random vectors (beyond the Nmax+2 POD modes
+   * that we need) and the number of power iterations used by the
+   * randomized POD. Larger values improve the accuracy of the computed
+   * modes at additional cost.
+   */
+  void set_randomized_POD_parameters(unsigned int oversampling,
+                                     unsigned int n_power_iterations);
+
   /**
    * Build a vector of ElemAssembly objects that accesses the basis
    * functions stored in this RBEIMConstruction object. This is useful
@@ -336,12 +358,35 @@ private:
    */
   Number node_inner_product(const NodeDataMap & v, const NodeDataMap & w);
 
+  /**
+   * Same as inner_product(), side_inner_product() and
+   * node_inner_product(), but only summing the contributions from
+   * this processor, without any communication.  These may be called
+   * concurrently.
+   */
+  Number local_inner_product(const QpDataMap & v, const QpDataMap & w) const;
+  Number local_side_inner_product(const SideQpDataMap & v, const SideQpDataMap & w) const;
+  Number local_node_inner_product(const NodeDataMap & v, const NodeDataMap & w) const;
+
   /**
    * Get the maximum absolute value from a vector stored in the format that we use
    * for basis functions.
    */
   template <class DataMap>
   Real get_max_abs_value(const DataMap & v) const
+  {
+    Real max_value = get_local_max_abs_value(v);
+    comm().max(max_value);
+    return max_value;
+  }
+
+  /**
+   * Same as get_max_abs_value(), but only over the data on this
+   * processor, without any communication.  This may be called
+   * concurrently.
+   */
+  template <class DataMap>
+  Real get_local_max_abs_value(const DataMap & v) const
   {
     Real max_value = 0.;
 
@@ -369,7 +414,6 @@ private:
           }
       }
 
-    comm().max(max_value);
     return max_value;
   }
 
@@ -379,6 +423,32 @@ private:
    */
   Real get_node_max_abs_value(const NodeDataMap & v) const;
 
+  /**
+   * Same as get_node_max_abs_value(), but only over the data on this
+   * processor, without any communication.  This may be called
+   * concurrently.
+   */
+  Real get_local_node_max_abs_value(const NodeDataMap & v) const;
+
+  /**
+   * Compute \p CV = C * \p V, where C is the POD correlation matrix of the
+   * training snapshots. C is never formed explicitly.
+   */
+  void apply_POD_correlation_matrix(const DenseMatrix<Number> & V,
+                                    DenseMatrix<Number> & CV);
+
+  /**
+   * Compute approximations to the \p n_modes dominant eigenpairs of the
+   * POD correlation matrix with a randomized subspace iteration followed
+   * by a Rayleigh-Ritz projection. On return \p sigma holds the
+   * eigenvalues in decreasing order and the columns of \p U hold the
+   * corresponding eigenvectors, in the same format as we obtain from an
+   * SVD of the full correlation matrix.
+   */
+  void compute_randomized_POD(unsigned int n_modes,
+                              DenseVector<Real> & sigma,
+                              DenseMatrix<Number> & U);
+
   /**
    * Add a new basis function to the EIM approximation.
    */
@@ -426,6 +496,14 @@ private:
   Real _rel_training_tolerance;
   Real _abs_training_tolerance;
 
+  /**
+   * Whether we use a randomized eigensolver in the POD training, and the
+   * oversampling and number of power iterations it uses.
+   */
+  bool _use_randomized_POD;
+  unsigned int _randomized_POD_oversampling;
+  unsigned int _randomized_POD_power_iterations;
+
   /**
    * The matrix we use in order to perform L2 projections of
    * parametrized functions as part of EIM training.
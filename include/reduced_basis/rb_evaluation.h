@@ -124,6 +124,34 @@ public:
   virtual Real rb_solve(unsigned int N,
                         const std::vector<Number> * evaluated_thetas);
 
+  /**
+   * Perform online solves with the N RB basis functions for each of
+   * the (single-step) parameters in \p mus, without changing the
+   * current parameters or the RB_solution and RB_outputs members.
+   * The theta functions are evaluated once per term for the whole
+   * batch, and the reduced systems are assembled and LU-solved
+   * concurrently across parameters.  If \p evaluated_thetas is
+   * provided, it must hold the pre-evaluated thetas for each
+   * parameter, laid out as for rb_solve(), and no theta functions
+   * are evaluated.
+   *
+   * If provided, \p solutions, \p outputs and \p output_error_bounds
+   * are resized to mus.size() and filled with the RB solution, the
+   * RB outputs and the output error bounds for each parameter.
+   * Output error bounds are only computed if
+   * \p evaluate_RB_error_bound is true.
+   *
+   * \returns The (absolute) error bound for each parameter, or -1
+   * for each parameter if \p evaluate_RB_error_bound is false.
+   */
+  virtual std::vector<Real>
+  rb_solve_batch(unsigned int N,
+                 const std::vector<RBParameters> & mus,
+                 const std::vector<std::vector<Number>> * evaluated_thetas = nullptr,
+                 std::vector<DenseVector<Number>> * solutions = nullptr,
+                 std::vector<std::vector<Number>> * outputs = nullptr,
+                 std::vector<std::vector<Real>> * output_error_bounds = nullptr);
+
   /**
    * \returns A scaling factor that we can use to provide a consistent
    * scaling of the RB error bound across different parameter values.
@@ -175,6 +203,16 @@ public:
    */
   virtual Real get_stability_lower_bound();
 
+  /**
+   * Get a lower bound for the stability constant at each of the
+   * parameters in \p mus.  By default this sets each parameter in
+   * turn and calls get_stability_lower_bound(), restoring the current
+   * parameters afterwards.  Override to provide a cheaper batched
+   * evaluation.
+   */
+  virtual std::vector<Real>
+  get_stability_lower_bounds(const std::vector<RBParameters> & mus);
+
   /**
    * Get the current number of basis functions.
    */
@@ -369,6 +407,16 @@ protected:
    */
   static void assert_file_exists(const std::string & file_name);
 
+  /**
+   * Compute the dual norm of the residual for the RB solution
+   * \p rb_solution, using the "A" and "F" thetas at the start of
+   * \p evaluated_thetas.  Does not modify \p this, so may be called
+   * concurrently.
+   */
+  Real residual_dual_norm(const unsigned int N,
+                          const DenseVector<Number> & rb_solution,
+                          const std::vector<Number> & evaluated_thetas) const;
+
 private:
 
   /**
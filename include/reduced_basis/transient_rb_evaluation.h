@@ -104,6 +104,19 @@ public:
    */
   virtual Real rb_solve_again();
 
+  /**
+   * Batched solves are not yet implemented for time-dependent
+   * problems; this throws rather than silently performing steady
+   * solves.
+   */
+  virtual std::vector<Real>
+  rb_solve_batch(unsigned int N,
+                 const std::vector<RBParameters> & mus,
+                 const std::vector<std::vector<Number>> * evaluated_thetas = nullptr,
+                 std::vector<DenseVector<Number>> * solutions = nullptr,
+                 std::vector<std::vector<Number>> * outputs = nullptr,
+                 std::vector<std::vector<Real>> * output_error_bounds = nullptr) override;
+
   /**
    * \returns A scaling factor that we can use to provide a consistent
    * scaling of the RB error bound across different parameter values.
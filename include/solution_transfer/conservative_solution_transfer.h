@@ -0,0 +1,82 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_CONSERVATIVE_SOLUTION_TRANSFER_H
+#define LIBMESH_CONSERVATIVE_SOLUTION_TRANSFER_H
+
+#include "libmesh/solution_transfer.h"
+
+namespace libMesh
+{
+
+/**
+ * Implementation of a SolutionTransfer object which does a
+ * conservative L2 projection of a variable from one mesh onto
+ * another.
+ *
+ * The right hand side integrals of the source solution against the
+ * target basis functions are computed on the intersections of
+ * target and source elements, found with a bin grid of source
+ * element bounding boxes.  The integrals are exact on affine
+ * elements of one and two dimensions: intervals of collinear edges
+ * are intersected directly, and (convex) polygonal faces lying in a
+ * common plane are clipped against each other.  Any other pair of
+ * elements falls back to integrating with a quadrature rule on the
+ * target element, assigning each quadrature point to the source
+ * element containing it.  The fallback conserves the integral only
+ * to within quadrature error.
+ *
+ * The target mass matrix is assembled and solved in parallel, or
+ * replaced by its row sums if \p lump_mass_matrix is set.  The lumped
+ * projection is cheaper and still conservative for bases which form
+ * a partition of unity, such as Lagrange bases, but it is less
+ * accurate.
+ *
+ * \note The "from" mesh must be serial, and a serialization of the
+ * "from" solution vector will be performed.
+ *
+ * \brief SolutionTransfer object which conserves integrals.
+ */
+class ConservativeSolutionTransfer : public SolutionTransfer
+{
+public:
+  ConservativeSolutionTransfer(const libMesh::Parallel::Communicator & comm_in);
+  virtual ~ConservativeSolutionTransfer();
+
+  /**
+   * Transfer the values of a variable to another.
+   */
+  virtual void transfer(const Variable & from_var, const Variable & to_var) override;
+
+  /**
+   * Set to \p true to divide by row sums of the target mass matrix
+   * instead of solving with it.  Defaults to \p false.
+   */
+  bool lump_mass_matrix;
+
+  /**
+   * Tolerance and iteration limit for the target mass matrix solve.
+   */
+  Real solver_tolerance;
+  unsigned int solver_max_iterations;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_CONSERVATIVE_SOLUTION_TRANSFER_H
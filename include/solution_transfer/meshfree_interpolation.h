@@ -24,6 +24,7 @@
 #include "libmesh/libmesh_config.h"
 #include "libmesh/libmesh_common.h"
 #include "libmesh/point.h"
+#include "libmesh/bounding_box.h"
 #include "libmesh/parallel_object.h"
 #ifdef LIBMESH_HAVE_NANOFLANN
 #  include "libmesh/ignore_warnings.h"
@@ -66,10 +67,17 @@ public:
    * from other processors, so all interpolation can be performed
    * locally.
    *
+   * SYNC_NEARBY_SOURCES copies to each processor only the remote
+   * data lying in the target region it declared with \p
+   * set_target_region(), so memory use scales with the local part of
+   * the problem.  Interpolation at a point outside the declared
+   * region only sees the sources near the region.
+   *
    * Other \p ParallelizationStrategy techniques will be implemented
    * as needed.
    */
   enum ParallelizationStrategy {SYNC_SOURCES     = 0,
+                                SYNC_NEARBY_SOURCES,
                                 INVALID_STRATEGY};
   /**
    * Constructor.
@@ -79,6 +87,27 @@ public:
     _parallelization_strategy (SYNC_SOURCES)
   {}
 
+  /**
+   * Sets the \p ParallelizationStrategy used by \p prepare_for_use().
+   */
+  void set_parallelization_strategy (ParallelizationStrategy strategy)
+  { _parallelization_strategy = strategy; }
+
+  /**
+   * \returns The \p ParallelizationStrategy used by \p prepare_for_use().
+   */
+  ParallelizationStrategy get_parallelization_strategy () const
+  { return _parallelization_strategy; }
+
+  /**
+   * Declares the box containing all the points this processor will
+   * interpolate at, for the SYNC_NEARBY_SOURCES strategy.  Remote
+   * sources within \p halo of the box are copied here; the halo
+   * should be wide enough to hold the sources each interpolation
+   * needs.  A processor with no target points may leave this unset.
+   */
+  void set_target_region (const BoundingBox & box, Real halo);
+
   /**
    * Prints information about this object, by default to
    * libMesh::out.
@@ -164,7 +193,19 @@ protected:
    */
   virtual void gather_remote_data ();
 
+  /**
+   * Gathers the source points and values added on other processors
+   * which lie in the target region of this processor.
+   */
+  void gather_nearby_remote_data ();
+
   ParallelizationStrategy  _parallelization_strategy;
+
+  /**
+   * The target region for SYNC_NEARBY_SOURCES, including its halo;
+   * empty (invalid) by default.
+   */
+  BoundingBox              _target_region;
   std::vector<std::string> _names;
   std::vector<Point>       _src_pts;
   std::vector<Number>      _src_vals;
@@ -19,18 +19,27 @@
 #define MESHFUNCTIONSOLUTIONTRANSFER_H
 
 #include "libmesh/solution_transfer.h"
+#include "libmesh/id_types.h"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace libMesh
 {
 
+// Forward Declarations
+class System;
+template <typename T> class SparseMatrix;
+
 /**
  * Implementation of a SolutionTransfer object that only works for
  * transferring the solution using a MeshFunction
  *
  * \note A serialization of the "from" solution vector will be
  * performed!  This can be slow in parallel and take a lot of memory!
+ * Call precompute_transfer() first to avoid that when transferring
+ * between the same variables repeatedly.
  *
  * \author Derek Gaston
  * \date 2013
@@ -46,6 +55,45 @@ public:
    * Transfer the values of a variable to another.
    */
   virtual void transfer(const Variable & from_var, const Variable & to_var) override;
+
+  /**
+   * Builds the interpolation from \p from_var to \p to_var as a
+   * sparse matrix.  Later calls to transfer() between the same two
+   * variables apply it as a parallel matrix-vector product, so they
+   * neither search the "from" mesh nor serialize its solution.
+   *
+   * The operator is only valid while neither mesh and neither dof
+   * numbering changes; call this again, or
+   * clear_precomputed_transfer(), when they do.
+   */
+  void precompute_transfer(const Variable & from_var, const Variable & to_var);
+
+  /**
+   * Discards the operator built by precompute_transfer().
+   */
+  void clear_precomputed_transfer();
+
+private:
+
+  /**
+   * The operator built by precompute_transfer(), mapping the whole
+   * "from" solution to the whole "to" solution; only the rows in \p
+   * _transfer_rows are used.
+   */
+  std::unique_ptr<SparseMatrix<Number>> _transfer_matrix;
+
+  /**
+   * The local "to" dofs which the operator computes.
+   */
+  std::vector<dof_id_type> _transfer_rows;
+
+  /**
+   * The variables the operator was built for.
+   */
+  const System * _from_sys = nullptr;
+  const System * _to_sys = nullptr;
+  unsigned int _from_var_num = 0;
+  unsigned int _to_var_num = 0;
 };
 
 } // namespace libMesh
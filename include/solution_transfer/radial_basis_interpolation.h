@@ -35,6 +35,15 @@ namespace libMesh
 /**
  * Radial Basis Function interpolation.
  *
+ * When a support radius is given to the constructor and nanoflann is
+ * available, the compact support of the Wendland functions is used:
+ * only source pairs within the radius are found (with the kd-tree)
+ * and stored, and the resulting sparse symmetric positive definite
+ * system is solved with conjugate gradients.  This scales to large
+ * point clouds as long as the radius only spans a few neighbors.
+ * Without a radius the support covers the whole bounding box, and the
+ * system is assembled and factored densely.
+ *
  * \author Benjamin S. Kirk
  * \date 2013
  * \brief Does radial basis function interpolation using Nanoflann.
@@ -71,6 +80,24 @@ protected:
    */
   Real _r_override;
 
+  /**
+   * Whether the system was assembled sparsely, in which case
+   * interpolation also only visits sources within the support radius.
+   */
+  bool _sparse;
+
+public:
+
+  /**
+   * Relative residual tolerance for the sparse iterative solve.
+   */
+  Real solver_tolerance;
+
+  /**
+   * Maximum number of iterations for the sparse iterative solve.
+   */
+  unsigned int solver_max_iterations;
+
 public:
 
   /**
@@ -80,7 +107,10 @@ public:
                             Real radius=-1) :
     InverseDistanceInterpolation<KDDim> (comm_in,8,2),
     _r_bbox(0.),
-    _r_override(radius)
+    _r_override(radius),
+    _sparse(false),
+    solver_tolerance(TOLERANCE*TOLERANCE),
+    solver_max_iterations(1000)
   { }
 
   /**
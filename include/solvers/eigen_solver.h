@@ -104,6 +104,37 @@ public:
     _close_matrix_before_solve = val;
   }
 
+  /**
+   * \returns \p true if the converged eigenvectors of each solve are
+   * kept and used as the initial space of the next solve.  \p false
+   * by default.
+   */
+  bool get_reuse_eigenspace() const { return _reuse_eigenspace; }
+
+  /**
+   * Set the flag which controls whether the converged eigenvectors of
+   * each solve are used to warm start the next one.  This pays off
+   * when a sequence of closely related eigenproblems is solved, e.g.
+   * during parameter continuation.  An initial space given through
+   * \p set_initial_space() takes precedence.
+   */
+  void set_reuse_eigenspace(bool val) { _reuse_eigenspace = val; }
+
+  /**
+   * \returns \p true if the spectral transformation (e.g. the
+   * shift-and-invert factorization) is kept between solves.
+   * \p false by default.
+   */
+  bool get_reuse_spectral_transformation() const { return _reuse_spectral_transformation; }
+
+  /**
+   * Set the flag which controls whether the spectral transformation
+   * is kept between solves.  Its factorization is only reused while
+   * the operators and the shift are unchanged, and is recomputed as
+   * soon as either of them changes.
+   */
+  void set_reuse_spectral_transformation(bool val) { _reuse_spectral_transformation = val; }
+
   /**
    * Release all memory and clear data structures.
    */
@@ -350,6 +381,12 @@ protected:
   Real _target_val;
 
   bool _close_matrix_before_solve;
+
+  /**
+   * Flags controlling the reuse of data between repeated solves.
+   */
+  bool _reuse_eigenspace;
+  bool _reuse_spectral_transformation;
 };
 
 } // namespace libMesh
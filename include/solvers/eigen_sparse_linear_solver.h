@@ -130,10 +130,19 @@ public:
 private:
 
   /**
-   * Tells Eigen to use the user-specified preconditioner stored in
-   * \p _preconditioner_type
+   * Runs the Eigen iterative solver \p EigenSolver, instantiated
+   * with the Eigen preconditioner matching the user-specified
+   * \p _preconditioner_type.  Supported types are IDENTITY_PRECOND,
+   * JACOBI_PRECOND, BLOCK_JACOBI_PRECOND (with blocks of the
+   * DofMap::block_size() of \p matrix, if known) and ILU_PRECOND.
    */
-  void set_eigen_preconditioner_type ();
+  template <template <typename> class EigenSolver>
+  std::pair<unsigned int, Real>
+  solve_with_preconditioner (EigenSparseMatrix<T> & matrix,
+                             EigenSparseVector<T> & solution,
+                             EigenSparseVector<T> & rhs,
+                             const double abs_tol,
+                             const int max_its);
 
   /**
    * Store the result of the last solve.
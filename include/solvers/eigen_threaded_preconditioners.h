@@ -0,0 +1,457 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_EIGEN_THREADED_PRECONDITIONERS_H
+#define LIBMESH_EIGEN_THREADED_PRECONDITIONERS_H
+
+#include "libmesh/libmesh_common.h"
+
+#ifdef LIBMESH_HAVE_EIGEN
+
+// Local includes
+#include "libmesh/eigen_core_support.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+namespace EigenThreading
+{
+// Below this many rows the cost of starting threads outweighs the
+// work done by a preconditioner kernel.
+const std::size_t threaded_min_size = 10000;
+
+/**
+ * Calls f(begin, end) on contiguous subranges covering [begin, end),
+ * concurrently if the range is long enough to be worth it.
+ */
+template <typename F>
+inline
+void range_for (const std::size_t begin, const std::size_t end, const F & f)
+{
+  if (libMesh::n_threads() == 1 || Threads::in_threads ||
+      end - begin < threaded_min_size)
+    {
+      f(begin, end);
+      return;
+    }
+
+  Threads::parallel_for
+    (Threads::BlockedRange<std::size_t>(begin, end, threaded_min_size),
+     [&f](const Threads::BlockedRange<std::size_t> & range)
+     { f(range.begin(), range.end()); });
+}
+}
+
+
+
+/**
+ * A block Jacobi preconditioner usable as the \p Preconditioner
+ * template argument of the Eigen iterative solvers.  The diagonal of
+ * the matrix is split into consecutive blocks of \p block_size()
+ * rows, which with the libMesh dof numbering are the dofs of each
+ * node when every variable lives in one variable group.  Each block
+ * is inverted densely in compute(), and both compute() and solve()
+ * are threaded over blocks.  A block size of 1 gives point Jacobi.
+ */
+template <typename Scalar>
+class EigenBlockJacobiPreconditioner
+{
+public:
+  typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1> Vector;
+  typedef Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> Block;
+
+  EigenBlockJacobiPreconditioner () :
+    _n(0),
+    _block_size(1),
+    _info(Eigen::Success)
+  {}
+
+  template <typename MatType>
+  explicit EigenBlockJacobiPreconditioner (const MatType & mat) :
+    EigenBlockJacobiPreconditioner()
+  {
+    this->compute(mat);
+  }
+
+  /**
+   * Sets the number of rows in each diagonal block.  Takes effect on
+   * the next compute().  The last block is shorter if \p block_size
+   * does not divide the matrix size.
+   */
+  void set_block_size (const unsigned int block_size)
+  {
+    libmesh_assert_greater(block_size, 0);
+    _block_size = block_size;
+  }
+
+  unsigned int block_size () const { return _block_size; }
+
+  Eigen::Index rows () const { return _n; }
+  Eigen::Index cols () const { return _n; }
+
+  template <typename MatType>
+  EigenBlockJacobiPreconditioner & analyzePattern (const MatType &)
+  {
+    return *this;
+  }
+
+  template <typename MatType>
+  EigenBlockJacobiPreconditioner & factorize (const MatType & mat)
+  {
+    libmesh_assert_equal_to(mat.rows(), mat.cols());
+
+    _n = mat.cols();
+    const std::size_t bs = _block_size;
+    const std::size_t n_blocks = (_n + bs - 1) / bs;
+    _inverses.assign(n_blocks * bs * bs, Scalar(0));
+
+    // The diagonal block holding a given outer index has both its
+    // rows and columns in that block's index range, so this works
+    // for either storage order.
+    EigenThreading::range_for
+      (0, n_blocks,
+       [this, &mat, bs](const std::size_t b_begin, const std::size_t b_end)
+       {
+         for (std::size_t b = b_begin; b != b_end; ++b)
+           {
+             const std::size_t first = b * bs;
+             const std::size_t n_rows = std::min(bs, std::size_t(_n) - first);
+
+             Block block = Block::Zero(n_rows, n_rows);
+             for (std::size_t k = first; k != first + n_rows; ++k)
+               for (typename MatType::InnerIterator it(mat, k); it; ++it)
+                 {
+                   const std::size_t i = it.row(), j = it.col();
+                   if (i >= first && i < first + n_rows &&
+                       j >= first && j < first + n_rows)
+                     block(i - first, j - first) = it.value();
+                 }
+
+             Eigen::Map<Block> inverse(&_inverses[b * bs * bs], n_rows, n_rows);
+
+             // Fall back on the (safeguarded) diagonal for singular
+             // blocks, as Eigen's own Jacobi preconditioner does for
+             // zero diagonal entries.
+             Eigen::FullPivLU<Block> lu(block);
+             if (lu.isInvertible())
+               inverse = lu.inverse();
+             else
+               {
+                 inverse.setZero();
+                 for (std::size_t i = 0; i != n_rows; ++i)
+                   inverse(i, i) = (block(i, i) == Scalar(0)) ?
+                     Scalar(1) : Scalar(1) / block(i, i);
+               }
+           }
+       });
+
+    _info = Eigen::Success;
+    return *this;
+  }
+
+  template <typename MatType>
+  EigenBlockJacobiPreconditioner & compute (const MatType & mat)
+  {
+    return this->factorize(mat);
+  }
+
+  template <typename Rhs>
+  Vector solve (const Eigen::MatrixBase<Rhs> & b) const
+  {
+    libmesh_assert_equal_to(b.size(), _n);
+
+    const Vector rhs = b;
+    Vector x(_n);
+
+    const std::size_t bs = _block_size;
+    const std::size_t n_blocks = (_n + bs - 1) / bs;
+
+    EigenThreading::range_for
+      (0, n_blocks,
+       [this, &rhs, &x, bs](const std::size_t b_begin, const std::size_t b_end)
+       {
+         for (std::size_t b = b_begin; b != b_end; ++b)
+           {
+             const std::size_t first = b * bs;
+             const std::size_t n_rows = std::min(bs, std::size_t(_n) - first);
+
+             Eigen::Map<const Block> inverse(&_inverses[b * bs * bs], n_rows, n_rows);
+             x.segment(first, n_rows).noalias() = inverse * rhs.segment(first, n_rows);
+           }
+       });
+
+    return x;
+  }
+
+  Eigen::ComputationInfo info () { return _info; }
+
+private:
+  Eigen::Index _n;
+
+  unsigned int _block_size;
+
+  /**
+   * The inverse of each diagonal block, stored column-major in a
+   * slot of block_size()^2 entries.
+   */
+  std::vector<Scalar> _inverses;
+
+  Eigen::ComputationInfo _info;
+};
+
+
+
+/**
+ * A zero fill-in incomplete LU factorization, usable as the
+ * \p Preconditioner template argument of the Eigen iterative solvers.
+ * The factors share the sparsity pattern of the matrix.  The
+ * triangular solves in solve() are level scheduled: rows are
+ * grouped into levels whose rows depend only on earlier levels, and
+ * the rows within each level are processed concurrently.
+ */
+template <typename Scalar>
+class EigenILU0Preconditioner
+{
+public:
+  typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1> Vector;
+  typedef Eigen::SparseMatrix<Scalar, Eigen::RowMajor, eigen_idx_type> Factors;
+
+  EigenILU0Preconditioner () :
+    _info(Eigen::Success)
+  {}
+
+  template <typename MatType>
+  explicit EigenILU0Preconditioner (const MatType & mat) :
+    EigenILU0Preconditioner()
+  {
+    this->compute(mat);
+  }
+
+  Eigen::Index rows () const { return _lu.rows(); }
+  Eigen::Index cols () const { return _lu.cols(); }
+
+  /**
+   * Copies the sparsity pattern of \p mat, adding any missing
+   * diagonal entries, and builds the level schedules for the
+   * triangular solves.
+   */
+  template <typename MatType>
+  EigenILU0Preconditioner & analyzePattern (const MatType & mat)
+  {
+    libmesh_assert_equal_to(mat.rows(), mat.cols());
+
+    _lu = mat;
+    _lu.makeCompressed();
+
+    const eigen_idx_type n = _lu.rows();
+
+    bool missing_diagonal = false;
+    for (eigen_idx_type i = 0; i != n; ++i)
+      if (_lu.coeff(i, i) == Scalar(0))
+        {
+          missing_diagonal = true;
+          _lu.coeffRef(i, i) = 0;
+        }
+    if (missing_diagonal)
+      _lu.makeCompressed();
+
+    const eigen_idx_type * outer = _lu.outerIndexPtr();
+    const eigen_idx_type * inner = _lu.innerIndexPtr();
+
+    _diagonal.resize(n);
+    for (eigen_idx_type i = 0; i != n; ++i)
+      _diagonal[i] = std::lower_bound(inner + outer[i], inner + outer[i+1], i) - inner;
+
+    // A row's level is one more than the deepest row it depends on.
+    std::vector<eigen_idx_type> level(n, 0);
+    for (eigen_idx_type i = 0; i != n; ++i)
+      for (eigen_idx_type k = outer[i]; k != _diagonal[i]; ++k)
+        level[i] = std::max(level[i], level[inner[k]] + 1);
+    build_schedule(level, _lower_levels, _lower_rows);
+
+    std::fill(level.begin(), level.end(), 0);
+    for (eigen_idx_type i = n; i-- != 0;)
+      for (eigen_idx_type k = _diagonal[i] + 1; k != outer[i+1]; ++k)
+        level[i] = std::max(level[i], level[inner[k]] + 1);
+    build_schedule(level, _upper_levels, _upper_rows);
+
+    return *this;
+  }
+
+  /**
+   * Computes the ILU(0) factors of \p mat, which must have the
+   * sparsity pattern last passed to analyzePattern().  Zero pivots
+   * are replaced by one, and reported through info().
+   */
+  template <typename MatType>
+  EigenILU0Preconditioner & factorize (const MatType & mat)
+  {
+    // Refresh the values, keeping any diagonal entries we added.
+    _lu *= Scalar(0);
+    for (Eigen::Index k = 0; k != mat.outerSize(); ++k)
+      for (typename MatType::InnerIterator it(mat, k); it; ++it)
+        _lu.coeffRef(it.row(), it.col()) = it.value();
+
+    const eigen_idx_type n = _lu.rows();
+    const eigen_idx_type * outer = _lu.outerIndexPtr();
+    const eigen_idx_type * inner = _lu.innerIndexPtr();
+    Scalar * values = _lu.valuePtr();
+
+    _info = Eigen::Success;
+
+    // Row-wise (IKJ) elimination restricted to the existing pattern;
+    // position[j] is the storage index of column j in row i, if any.
+    std::vector<eigen_idx_type> position(n, -1);
+    for (eigen_idx_type i = 0; i != n; ++i)
+      {
+        for (eigen_idx_type k = outer[i]; k != outer[i+1]; ++k)
+          position[inner[k]] = k;
+
+        for (eigen_idx_type k = outer[i]; k != _diagonal[i]; ++k)
+          {
+            const eigen_idx_type j = inner[k];
+            values[k] /= values[_diagonal[j]];
+            for (eigen_idx_type kk = _diagonal[j] + 1; kk != outer[j+1]; ++kk)
+              if (position[inner[kk]] != -1)
+                values[position[inner[kk]]] -= values[k] * values[kk];
+          }
+
+        if (values[_diagonal[i]] == Scalar(0))
+          {
+            values[_diagonal[i]] = 1;
+            _info = Eigen::NumericalIssue;
+          }
+
+        for (eigen_idx_type k = outer[i]; k != outer[i+1]; ++k)
+          position[inner[k]] = -1;
+      }
+
+    return *this;
+  }
+
+  template <typename MatType>
+  EigenILU0Preconditioner & compute (const MatType & mat)
+  {
+    this->analyzePattern(mat);
+    return this->factorize(mat);
+  }
+
+  template <typename Rhs>
+  Vector solve (const Eigen::MatrixBase<Rhs> & b) const
+  {
+    libmesh_assert_equal_to(b.size(), _lu.rows());
+
+    const eigen_idx_type * outer = _lu.outerIndexPtr();
+    const eigen_idx_type * inner = _lu.innerIndexPtr();
+    const Scalar * values = _lu.valuePtr();
+
+    Vector x = b;
+
+    // Forward substitution with the unit lower triangle
+    for (std::size_t l = 0; l + 1 < _lower_levels.size(); ++l)
+      EigenThreading::range_for
+        (_lower_levels[l], _lower_levels[l+1],
+         [this, outer, inner, values, &x](const std::size_t r_begin, const std::size_t r_end)
+         {
+           for (std::size_t r = r_begin; r != r_end; ++r)
+             {
+               const eigen_idx_type i = _lower_rows[r];
+               Scalar sum = x[i];
+               for (eigen_idx_type k = outer[i]; k != _diagonal[i]; ++k)
+                 sum -= values[k] * x[inner[k]];
+               x[i] = sum;
+             }
+         });
+
+    // Backward substitution with the upper triangle
+    for (std::size_t l = 0; l + 1 < _upper_levels.size(); ++l)
+      EigenThreading::range_for
+        (_upper_levels[l], _upper_levels[l+1],
+         [this, outer, inner, values, &x](const std::size_t r_begin, const std::size_t r_end)
+         {
+           for (std::size_t r = r_begin; r != r_end; ++r)
+             {
+               const eigen_idx_type i = _upper_rows[r];
+               Scalar sum = x[i];
+               for (eigen_idx_type k = _diagonal[i] + 1; k != outer[i+1]; ++k)
+                 sum -= values[k] * x[inner[k]];
+               x[i] = sum / values[_diagonal[i]];
+             }
+         });
+
+    return x;
+  }
+
+  Eigen::ComputationInfo info () { return _info; }
+
+private:
+  /**
+   * Sorts the rows by \p level into \p rows, with the rows of level
+   * l in [offsets[l], offsets[l+1]).
+   */
+  static void build_schedule (const std::vector<eigen_idx_type> & level,
+                              std::vector<std::size_t> & offsets,
+                              std::vector<eigen_idx_type> & rows)
+  {
+    const eigen_idx_type n_levels = level.empty() ? 0 :
+      *std::max_element(level.begin(), level.end()) + 1;
+
+    offsets.assign(n_levels + 1, 0);
+    for (const eigen_idx_type l : level)
+      ++offsets[l+1];
+    for (eigen_idx_type l = 0; l != n_levels; ++l)
+      offsets[l+1] += offsets[l];
+
+    rows.resize(level.size());
+    std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+    for (std::size_t i = 0; i != level.size(); ++i)
+      rows[next[level[i]]++] = cast_int<eigen_idx_type>(i);
+  }
+
+  /**
+   * The strictly lower part holds L (with an implicit unit
+   * diagonal), the rest holds U.
+   */
+  Factors _lu;
+
+  /**
+   * The storage index of each row's diagonal entry in \p _lu.
+   */
+  std::vector<eigen_idx_type> _diagonal;
+
+  /**
+   * Level schedules for the lower and upper triangular solves.
+   */
+  std::vector<std::size_t> _lower_levels, _upper_levels;
+  std::vector<eigen_idx_type> _lower_rows, _upper_rows;
+
+  Eigen::ComputationInfo _info;
+};
+
+} // namespace libMesh
+
+#endif // #ifdef LIBMESH_HAVE_EIGEN
+
+#endif // LIBMESH_EIGEN_THREADED_PRECONDITIONERS_H
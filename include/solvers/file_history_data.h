@@ -4,6 +4,12 @@
 #include "libmesh/history_data.h"
 #include "libmesh/diff_system.h"
 
+// C++ includes
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace libMesh
 {
 
@@ -19,9 +25,14 @@ namespace libMesh
     {
         public:
 
-        FileHistoryData(DifferentiableSystem & system) : HistoryData(), _system(system),mesh_filename(""), primal_filename(""), adjoint_filename("") {};
+        // If asynchronous is true, each processor writes its own part of
+        // the system vectors to a binary file on a background thread, and
+        // reads can be started early with prefetch_primal_solution() /
+        // prefetch_adjoint_solution().
+        FileHistoryData(DifferentiableSystem & system, bool asynchronous = false) : HistoryData(), _system(system), _asynchronous(asynchronous), mesh_filename(""), primal_filename(""), adjoint_filename("") {};
 
-        ~FileHistoryData() {};
+        // Waits for any background reads or writes to finish.
+        ~FileHistoryData();
 
         // Accessors for FileHistory specific variables
         std::string & get_mesh_filename()
@@ -50,11 +61,41 @@ namespace libMesh
         virtual void retrieve_primal_solution() override;
         virtual void retrieve_adjoint_solution() override;
 
+        // Start reading the primal or adjoint file in the background, so
+        // that a later retrieve of it doesn't have to wait on the disk.
+        // These do nothing unless the data is asynchronous.
+        void prefetch_primal_solution();
+        void prefetch_adjoint_solution();
+
+        // The locally owned entries of the stored vectors, by name
+        typedef std::vector<std::pair<std::string, std::vector<Number>>> vector_snapshot;
+
         private:
 
+        // Writes the system vectors to \p filename, in the background if
+        // we are asynchronous, or with EquationSystems::write otherwise.
+        void write_solution(const std::string & filename);
+
+        // Reads the system vectors from \p filename, using a prefetched
+        // copy if there is one.
+        void read_solution(const std::string & filename);
+
+        // Starts a background read of \p filename.
+        void prefetch(const std::string & filename);
+
         // Reference to underlying system
         DifferentiableSystem & _system;
 
+        // Whether we use per-processor files and background I/O
+        bool _asynchronous;
+
+        // The last background write, which reads of the same files wait on
+        std::shared_future<void> _pending_write;
+
+        // A background read, and the file it is reading
+        std::future<vector_snapshot> _pending_read;
+        std::string _prefetched_filename;
+
         // File History specific variables
         std::string mesh_filename;
         std::string primal_filename;
@@ -73,11 +73,27 @@ public:
    */
   virtual std::unique_ptr<SolutionHistory> clone() const override;
 
+  /**
+   * Sets whether history entries are written and read on background
+   * threads.  Asynchronous entries are stored as one binary file per
+   * processor, holding only the locally owned vector entries, so they
+   * can only be retrieved with the same partitioning.  While a
+   * solution is being retrieved the next entry in the sweep is
+   * prefetched.  Must be set before the first store().
+   */
+  void set_asynchronous(bool asynchronous)
+  { libmesh_assert(stored_data.empty()); _asynchronous = asynchronous; }
+
+  bool asynchronous() const { return _asynchronous; }
+
 private:
 
   // A system reference
   DifferentiableSystem & _system;
 
+  // Whether we do our file I/O in the background
+  bool _asynchronous;
+
   /**
    * A vector of pointers to adjoint and old adjoint solutions at the last time step.
    * These are used to prevent the zeroing of the adjoint and old adjoint by es::read.
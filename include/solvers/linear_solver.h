@@ -204,6 +204,37 @@ public:
                                        const std::optional<double> tol = std::nullopt,
                                        const std::optional<unsigned int> m_its = std::nullopt); // N. Iterations
 
+  /**
+   * Solves the system with matrix \p matrix, preconditioned by \p
+   * precond_matrix if it is provided, for each right-hand side in \p
+   * rhs, putting the results in the corresponding entries of \p
+   * solutions.  Since the matrix is the same for every solve, the
+   * preconditioner is built (unless it is already being reused) by
+   * the first solve and reused by the rest.
+   *
+   * \returns The sums of the iteration counts and of the final
+   * residuals of the solves.
+   */
+  virtual std::pair<unsigned int, Real> solve_multiple (SparseMatrix<T> & matrix,
+                                                        SparseMatrix<T> * precond_matrix,
+                                                        const std::vector<NumericVector<T> *> & solutions,
+                                                        const std::vector<NumericVector<T> *> & rhs,
+                                                        const std::optional<double> tol = std::nullopt,
+                                                        const std::optional<unsigned int> m_its = std::nullopt);
+
+  /**
+   * Solves the adjoint system for each right-hand side in \p rhs,
+   * reusing the preconditioner as \p solve_multiple() does.
+   *
+   * \returns The sums of the iteration counts and of the final
+   * residuals of the solves.
+   */
+  virtual std::pair<unsigned int, Real> adjoint_solve_multiple (SparseMatrix<T> & matrix,
+                                                                const std::vector<NumericVector<T> *> & solutions,
+                                                                const std::vector<NumericVector<T> *> & rhs,
+                                                                const std::optional<double> tol = std::nullopt,
+                                                                const std::optional<unsigned int> m_its = std::nullopt);
+
 
 
   /**
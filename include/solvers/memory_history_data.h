@@ -6,6 +6,8 @@
 #include "libmesh/diff_system.h"
 
 #include "libmesh/numeric_vector.h"
+#include "libmesh/reduced_precision_vector.h"
+#include "libmesh/compressed_vector.h"
 
 namespace libMesh
 {
@@ -18,7 +20,12 @@ namespace libMesh
         public:
 
         // Constructor
-        MemoryHistoryData(DifferentiableSystem & system) : HistoryData(), _system(system), stored_vecs{}, stored_vec(stored_vecs.end()) {};
+        // If reduced_precision is true, vectors are stored in single precision.
+        // If compressed is true, vectors are stored as CompressedVectors,
+        // rounded to within compression_tolerance.
+        MemoryHistoryData(DifferentiableSystem & system, bool reduced_precision = false,
+                          bool compressed = false, Real compression_tolerance = 0) : HistoryData(), _system(system), _reduced_precision(reduced_precision), _compressed(compressed), _compression_tolerance(compression_tolerance), stored_vecs{}, stored_vec(stored_vecs.end())
+        { libmesh_error_msg_if(reduced_precision && compressed, "Cannot store history vectors in both reduced precision and compressed form"); };
 
         // Destructor
         ~MemoryHistoryData() {};
@@ -38,6 +45,12 @@ namespace libMesh
 
         DifferentiableSystem & _system;
 
+        bool _reduced_precision;
+
+        bool _compressed;
+
+        Real _compression_tolerance;
+
         typedef std::map<std::string, std::unique_ptr<NumericVector<Number>>> map_type;
         typedef map_type::iterator stored_vecs_iterator;
 
@@ -46,6 +59,12 @@ namespace libMesh
         map_type stored_vecs;
         stored_vecs_iterator stored_vec;
 
+        // The vectors, when they are stored in reduced precision
+        std::map<std::string, ReducedPrecisionVector<Number>> reduced_vecs;
+
+        // The vectors, when they are stored compressed
+        std::map<std::string, CompressedVector<Number>> compressed_vecs;
+
     };
 
 }
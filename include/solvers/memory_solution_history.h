@@ -48,7 +48,8 @@ public:
    * Constructor, reference to system to be passed by user, set the
    * stored_sols iterator to some initial value
    */
-  MemorySolutionHistory(DifferentiableSystem & system_) : SolutionHistory(), _system(system_)
+  MemorySolutionHistory(DifferentiableSystem & system_) : SolutionHistory(), _system(system_), _reduced_precision(false),
+    _compressed(false), _compression_tolerance(0)
   { libmesh_experimental(); }
 
   /**
@@ -68,18 +69,66 @@ public:
 
   typedef std::map<std::string, std::unique_ptr<NumericVector<Number>>> map_type;
 
+  /**
+   * If \p reduced_precision is true, vectors stored from now on are
+   * kept in single precision (see ReducedPrecisionVector), halving
+   * the memory used by a long history at the cost of rounding the
+   * retrieved solutions to about seven significant digits.
+   */
+  void set_reduced_precision (bool reduced_precision)
+  { _reduced_precision = reduced_precision; }
+
+  /**
+   * \returns Whether vectors are stored in single precision.
+   */
+  bool reduced_precision () const
+  { return _reduced_precision; }
+
+  /**
+   * If \p compressed is true, vectors stored from now on are kept as
+   * CompressedVectors.  With a zero \p tolerance the compression is
+   * lossless; with a positive \p tolerance each retrieved entry is
+   * within \p tolerance of the stored one, which typically shrinks
+   * smooth solutions several times more.  This can't be combined
+   * with reduced precision storage.
+   */
+  void set_compression (bool compressed, Real tolerance = 0)
+  { _compressed = compressed; _compression_tolerance = tolerance; }
+
+  /**
+   * \returns Whether vectors are stored compressed.
+   */
+  bool compressed () const
+  { return _compressed; }
+
+  /**
+   * \returns The error bound compressed vectors are stored to.
+   */
+  Real compression_tolerance () const
+  { return _compression_tolerance; }
+
   /**
    * Definition of the clone function needed for the setter function
    */
   virtual std::unique_ptr<SolutionHistory > clone() const override
   {
-    return std::make_unique<MemorySolutionHistory>(_system);
+    auto history = std::make_unique<MemorySolutionHistory>(_system);
+    history->set_reduced_precision(_reduced_precision);
+    history->set_compression(_compressed, _compression_tolerance);
+    return history;
   }
 
 private:
 
   // A system reference
   DifferentiableSystem & _system ;
+
+  // Whether to store vectors in single precision
+  bool _reduced_precision;
+
+  // Whether, and to what tolerance, to store vectors compressed
+  bool _compressed;
+  Real _compression_tolerance;
 };
 
 } // end namespace libMesh
@@ -0,0 +1,109 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_MIXED_PRECISION_REFINEMENT_H
+#define LIBMESH_MIXED_PRECISION_REFINEMENT_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <memory>
+#include <utility>
+
+namespace libMesh
+{
+
+// Forward Declarations
+template <typename T> class NumericVector;
+template <typename T> class SparseMatrix;
+
+/**
+ * Solves a linear system using a single precision LU factorization
+ * of its matrix, and recovers \p Number precision by iterative
+ * refinement: each step computes the residual b - Ax in full
+ * precision and corrects x by the single precision solution for that
+ * residual.  The factors take half the memory and bandwidth of full
+ * precision ones; refinement converges as long as the matrix
+ * condition number is well below the inverse of single precision
+ * machine epsilon (about 1e7).
+ *
+ * The factorization uses Eigen and needs the whole matrix, so this
+ * class requires libMesh to be configured with Eigen, and only
+ * supports serial solves.  Any matrix type which implements
+ * \p SparseMatrix::get_row() can be factored.
+ */
+class MixedPrecisionRefinement : public ParallelObject
+{
+public:
+  explicit
+  MixedPrecisionRefinement (const Parallel::Communicator & comm_in);
+
+  ~MixedPrecisionRefinement ();
+
+  /**
+   * Factors a single precision copy of \p matrix, replacing any
+   * previous factorization.
+   */
+  void factor (const SparseMatrix<Number> & matrix);
+
+  /**
+   * \returns Whether a factorization is available for solve().
+   */
+  bool factored () const { return _factorization != nullptr; }
+
+  /**
+   * Discards the factorization.
+   */
+  void clear ();
+
+  /**
+   * Refines \p solution, used as the initial guess, towards the
+   * solution of \p matrix * \p solution = \p rhs.  Refinement stops
+   * when the residual l2 norm is at most \p tol times that of \p rhs,
+   * when it stops decreasing, or after \p max_steps corrections.
+   *
+   * The factorization may be of an older version of \p matrix; it
+   * only needs to be a good enough approximation of it for the
+   * refinement to converge.
+   *
+   * \returns The number of corrections and the final residual norm.
+   */
+  std::pair<unsigned int, Real>
+  solve (const SparseMatrix<Number> & matrix,
+         NumericVector<Number> & solution,
+         const NumericVector<Number> & rhs,
+         const Real tol,
+         const unsigned int max_steps);
+
+private:
+
+  /**
+   * The single precision factorization, hiding Eigen from this header
+   */
+  struct Factorization;
+
+  std::unique_ptr<Factorization> _factorization;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MIXED_PRECISION_REFINEMENT_H
@@ -23,6 +23,9 @@
 // Local includes
 #include "libmesh/second_order_unsteady_solver.h"
 
+// C++ includes
+#include <memory>
+
 namespace libMesh
 {
 /**
@@ -63,6 +66,12 @@ public:
    */
   virtual ~NewmarkSolver ();
 
+  /**
+   * Drops the cached lumped mass and stable timestep, which depend on
+   * the mesh and the dof numbering.
+   */
+  virtual void reinit () override;
+
   /**
    * This method advances the solution to the next timestep, after a
    * solve() has been performed.  Often this will be done after every
@@ -157,6 +166,48 @@ public:
   void set_gamma ( Real gamma )
   { _gamma = gamma; }
 
+  /**
+   * Switches to (or from) the explicit central difference scheme,
+   * i.e. Newmark with \f$ \beta = 0 \f$ and \f$ \gamma = 1/2 \f$.
+   * Each timestep then takes a single residual assembly and no
+   * linear solve: the acceleration is obtained by inverting a
+   * row-sum lumped mass matrix, and damping terms are evaluated at
+   * the predicted velocity \f$ v_n + \frac{\Delta t}{2} a_n \f$.
+   * If no initial acceleration has been set, it is computed the same
+   * way on the first solve.
+   *
+   * The lumped mass is computed from the mass residual on the first
+   * step and kept until \p reinit(), so it must not depend on the
+   * solution.  Only second order variables are supported.
+   */
+  void set_explicit ( bool explicit_scheme )
+  { _explicit = explicit_scheme; }
+
+  /**
+   * \returns \p true if the explicit central difference scheme is used.
+   */
+  bool is_explicit () const
+  { return _explicit; }
+
+  /**
+   * Sets the fastest wave speed in the problem, to be used for timestep
+   * estimates.  When it is positive, explicit solves limit
+   * \p deltat to \p stable_timestep().
+   */
+  void set_wave_speed ( Real wave_speed, Real courant_number = 0.9 );
+
+  /**
+   * \returns The Courant-Friedrichs-Lewy estimate of the stable
+   * explicit timestep, i.e. the Courant number times the smallest
+   * active element \p hmin() divided by the wave speed.  Element
+   * sizes are taken from the mesh's element geometry cache if it has
+   * one, and the result is cached until \p reinit().
+   *
+   * \note The estimate is meant for first order elements.  Higher
+   * order elements generally need a smaller Courant number.
+   */
+  Real stable_timestep ();
+
 protected:
 
   /**
@@ -186,6 +237,51 @@ protected:
    */
   bool _initial_accel_set;
 
+  /**
+   * Whether the explicit central difference scheme is used.
+   */
+  bool _explicit;
+
+  /**
+   * The wave speed and Courant number for timestep estimates, and
+   * the cached estimate (0 when not yet computed).
+   */
+  Real _wave_speed;
+  Real _courant_number;
+  Real _stable_timestep;
+
+  /**
+   * The inverse of the lumped mass, zero for dofs without mass.
+   */
+  std::unique_ptr<NumericVector<Number>> _inverse_lumped_mass;
+
+  /**
+   * State for _general_residual() during explicit residual
+   * assemblies.  The context velocity is the old velocity plus
+   * \p _explicit_rate_weight times the old acceleration, the context
+   * acceleration is \p _explicit_accel_fill everywhere, and the time
+   * is \p _explicit_theta of the way into the timestep.
+   */
+  bool _is_explicit_assembly;
+  Real _explicit_rate_weight;
+  Real _explicit_accel_fill;
+  Real _explicit_theta;
+
+  /**
+   * Advances the solution by one explicit timestep.
+   */
+  void explicit_solve ();
+
+  /**
+   * Computes the acceleration at the current solution into \p accel,
+   * with the context set up as described for
+   * \p _is_explicit_assembly.  Computes the lumped mass first if
+   * necessary.
+   */
+  void explicit_accel (Real rate_weight,
+                       Real theta,
+                       NumericVector<Number> & accel);
+
   /**
    * This method is the underlying implementation of the public
    * residual methods.
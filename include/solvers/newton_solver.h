@@ -142,6 +142,89 @@ public:
    */
   double linear_tolerance_multiplier;
 
+  /**
+   * If this is set (it is null by default), the system jacobian is
+   * never assembled: each linear solve applies this operator, e.g. a
+   * MatrixFreeSystemOperator, instead.  The system's "Preconditioner"
+   * matrix, if any, is still passed to the linear solver.
+   */
+  ShellMatrix<Number> * jacobian_operator;
+
+  /**
+   * The jacobian is reassembled every \p lag_jacobian Newton steps
+   * (by default 1, i.e. every step).  The steps in between assemble
+   * only the residual and solve with the last jacobian, much like
+   * PETSc's -snes_lag_jacobian.  Lagging stops early, and the
+   * jacobian is reassembled, if either test below fails.
+   *
+   * This has no effect when \p jacobian_operator is set.
+   */
+  unsigned int lag_jacobian;
+
+  /**
+   * If this is nonzero (it is 0 by default), a linear solve with a
+   * lagged jacobian which takes more than this many iterations makes
+   * the next step reassemble the jacobian.
+   */
+  unsigned int lag_jacobian_max_linear_iterations;
+
+  /**
+   * If the nonlinear residual after a step taken with a lagged
+   * jacobian is more than this fraction (by default 0.5) of the
+   * residual before it, the jacobian is reassembled before the next
+   * linear solve.
+   */
+  Real lag_jacobian_max_residual_ratio;
+
+  /**
+   * If this is set to true (it is false by default), a lagged
+   * jacobian is kept from one solve() to the next, e.g. across the
+   * time steps of a transient problem, instead of being reassembled
+   * at the start of each solve.  reinit() always discards it.
+   */
+  bool lag_jacobian_persists;
+
+  /**
+   * Of the jacobians which are assembled, only every
+   * \p lag_preconditioner th one (by default 1, i.e. every one) has
+   * a new preconditioner built for it; the others reuse the last
+   * preconditioner via LinearSolver::reuse_preconditioner().  With
+   * the default, the linear solver's own reuse setting is left alone.
+   */
+  unsigned int lag_preconditioner;
+
+  /**
+   * If this is set to true (it is false by default), the tolerance
+   * for each linear solve is an Eisenstat-Walker forcing term,
+   * computed from the ratio of successive nonlinear residuals, in
+   * place of the \p linear_tolerance_multiplier rule.  We use their
+   * second choice,
+   * \f$ \eta_k = \gamma (\|F_k\| / \|F_{k-1}\|)^\alpha \f$,
+   * safeguarded by \f$ \gamma \eta_{k-1}^\alpha \f$ when that
+   * exceeds 0.1, starting from and capped at
+   * \p eisenstat_walker_max.  The result is still kept above
+   * \p minimum_linear_tolerance.
+   */
+  bool eisenstat_walker;
+
+  /**
+   * The \f$ \gamma \f$ factor in the Eisenstat-Walker forcing term
+   * (0.9 by default).
+   */
+  Real eisenstat_walker_gamma;
+
+  /**
+   * The \f$ \alpha \f$ exponent in the Eisenstat-Walker forcing
+   * term (2 by default).
+   */
+  Real eisenstat_walker_alpha;
+
+  /**
+   * The first and largest Eisenstat-Walker forcing term (0.9 by
+   * default).
+   */
+  Real eisenstat_walker_max;
+
 protected:
 
   /**
@@ -181,6 +264,19 @@ protected:
   bool test_convergence(Real current_residual,
                         Real step_norm,
                         bool linear_solve_finished);
+
+private:
+  /**
+   * The number of linear solves done with the current jacobian, or
+   * invalid_uint if there is no jacobian to reuse.
+   */
+  unsigned int _jacobian_age;
+
+  /**
+   * The number of jacobians assembled since the preconditioner was
+   * last rebuilt, or invalid_uint if it must be rebuilt.
+   */
+  unsigned int _preconditioner_age;
 };
 
 
@@ -42,6 +42,13 @@
 namespace libMesh
 {
 
+// The SNES callbacks used by PetscDiffSolver
+extern "C"
+{
+  PetscErrorCode __libmesh_petsc_diff_solver_residual (SNES, Vec x, Vec r, void * ctx);
+  PetscErrorCode __libmesh_petsc_diff_solver_jacobian (SNES, Vec x, Mat j, Mat pc, void * ctx);
+}
+
 /**
  * This class defines a solver which uses a PETSc SNES
  * context to handle a DifferentiableSystem
@@ -93,6 +100,23 @@ public:
    */
   virtual unsigned int solve () override;
 
+  /**
+   * Set to true to have each residual evaluation also assemble the
+   * Jacobian, in the same element loop.  The next Jacobian
+   * evaluation then reuses that matrix if it is requested at the
+   * same solution, which for Newton with a full Jacobian update
+   * every step saves one residual assembly per iteration.
+   *
+   * This only takes effect for an \p SNESNEWTONLS solve which calls
+   * our own Jacobian function without lagging the Jacobian.
+   * Residuals at rejected line search points, and at the final
+   * converged solution, still pay for a Jacobian which is never
+   * used.
+   *
+   * Defaults to false.
+   */
+  bool fuse_residual_and_jacobian;
+
 protected:
 
   /**
@@ -115,6 +139,33 @@ private:
    * Common helper function to setup PETSc data structures
    */
   void setup_petsc_data();
+
+  /**
+   * \returns Whether residual and Jacobian evaluations can be fused
+   * for the SNES configuration we are about to solve with.
+   */
+  bool can_fuse_residual_and_jacobian();
+
+  /**
+   * Whether residual evaluations assemble the Jacobian too during
+   * the current solve
+   */
+  bool _fused_jacobian_active;
+
+  /**
+   * Whether the SNES preconditioning matrix currently holds the
+   * Jacobian at \p _fused_jacobian_solution
+   */
+  bool _fused_jacobian_valid;
+
+  /**
+   * The solution at which the last fused residual evaluation
+   * assembled the Jacobian
+   */
+  WrappedPetsc<Vec> _fused_jacobian_solution;
+
+  friend PetscErrorCode __libmesh_petsc_diff_solver_residual (SNES, Vec x, Vec r, void * ctx);
+  friend PetscErrorCode __libmesh_petsc_diff_solver_jacobian (SNES, Vec x, Mat j, Mat pc, void * ctx);
 };
 
 } // namespace libMesh
@@ -160,6 +160,28 @@ public:
    */
   void set_jacobian_zero_out(bool state) { _zero_out_jacobian = state; }
 
+  /**
+   * Set to true to have each residual evaluation through a \p matvec
+   * function also assemble the Jacobian, in the same element loop.
+   * The next Jacobian evaluation then reuses that matrix if it is
+   * requested at the same solution, which for Newton with a full
+   * Jacobian update every step saves one residual assembly per
+   * iteration.
+   *
+   * This only takes effect for an \p SNESNEWTONLS solve which calls
+   * our own Jacobian function without lagging the Jacobian; otherwise
+   * residuals are assembled alone as usual.  Residuals at rejected
+   * line search points, and at the final converged solution, still
+   * pay for a Jacobian which is never used.
+   */
+  void set_fused_residual_and_jacobian(bool state) { _fuse_residual_and_jacobian = state; }
+
+  /**
+   * \returns Whether residual evaluations through \p matvec may
+   * assemble the Jacobian too.
+   */
+  bool fused_residual_and_jacobian() const { return _fuse_residual_and_jacobian; }
+
   /**
    * Set to true to use the libMesh's default monitor, set to false to use your own
    */
@@ -287,7 +309,37 @@ protected:
     */
   bool _setup_reuse;
 
+  /**
+   * Whether residual evaluations via \p matvec should assemble the
+   * Jacobian too, when the SNES setup allows it
+   */
+  bool _fuse_residual_and_jacobian;
+
+  /**
+   * Whether residual evaluations assemble the Jacobian too during
+   * the current solve
+   */
+  bool _fused_jacobian_active;
+
+  /**
+   * Whether the SNES preconditioning matrix currently holds the
+   * Jacobian at \p _fused_jacobian_solution
+   */
+  bool _fused_jacobian_valid;
+
+  /**
+   * The solution at which the last fused residual evaluation
+   * assembled the Jacobian
+   */
+  WrappedPetsc<Vec> _fused_jacobian_solution;
+
 private:
+  /**
+   * \returns Whether residual and Jacobian evaluations can be fused
+   * for the SNES configuration we are about to solve with.
+   */
+  bool can_fuse_residual_and_jacobian();
+
   friend ResidualContext libmesh_petsc_snes_residual_helper (SNES snes, Vec x, void * ctx);
   friend PetscErrorCode libmesh_petsc_snes_residual (SNES snes, Vec x, Vec r, void * ctx);
   friend PetscErrorCode libmesh_petsc_snes_fd_residual (SNES snes, Vec x, Vec r, void * ctx);
@@ -27,6 +27,10 @@
 // Local includes
 #include "libmesh/eigen_solver.h"
 #include "libmesh/slepc_macro.h"
+#include "libmesh/wrapped_petsc.h"
+
+// C++ includes
+#include <vector>
 
 // SLEPc include files.
 EXTERN_C_FOR_SLEPC_BEGIN
@@ -245,12 +249,23 @@ public:
    */
   virtual void attach_deflation_space(NumericVector<T> & deflation_vector) override;
 
+  /**
+   * Remove all vectors attached through \p attach_deflation_space().
+   */
+  void clear_deflation_space();
+
   /**
    * Use \p initial_space_in as the initial guess.
    */
   virtual void
   set_initial_space(NumericVector<T> & initial_space_in) override;
 
+  /**
+   * Forget the eigenvectors kept from the previous solve when
+   * \p get_reuse_eigenspace() is true.
+   */
+  void clear_eigenspace();
+
   /**
    * \returns The raw SLEPc \p EPS pointer.
    */
@@ -258,6 +273,26 @@ public:
 
 private:
 
+  /**
+   * Destroys and recreates the EPS before a solve, unless the spectral
+   * transformation is to be reused.
+   */
+  void prepare_eps ();
+
+  /**
+   * Keeps copies of the first \p n_vectors converged eigenvectors,
+   * to be used as the initial space of the next solve.
+   */
+  void save_eigenspace (PetscInt n_vectors);
+
+  /**
+   * Tells the spectral transformation's KSP to keep its
+   * preconditioner (typically the shift-and-invert factorization) if
+   * the operators and the target have not changed since the last
+   * solve.
+   */
+  void reuse_factorization_if_unchanged ();
+
   /**
    * Helper function that actually performs the standard eigensolve.
    */
@@ -329,6 +364,24 @@ private:
    * A vector used for initial space. The vector will be used as the basis for EPS.
    */
   PetscVector<T>* _initial_space;
+
+  /**
+   * The converged eigenvectors of the previous solve, and the
+   * vectors spanning the deflation space.
+   */
+  std::vector<WrappedPetsc<Vec>> _eigenspace;
+  std::vector<WrappedPetsc<Vec>> _deflation_space;
+
+  /**
+   * The operators, their object states and the target the
+   * spectral transformation was last set up with.
+   */
+  bool _factored_operators;
+  Mat _factored_A;
+  Mat _factored_B;
+  PetscObjectState _factored_A_state;
+  PetscObjectState _factored_B_state;
+  PetscScalar _factored_target;
 };
 
 } // namespace libMesh
@@ -94,6 +94,18 @@ public:
   virtual void integrate_adjoint_refinement_error_estimate(AdjointRefinementEstimator & adjoint_refinement_error_estimator, ErrorVector & QoI_elementwise_error) override;
 #endif // LIBMESH_ENABLE_AMR
 
+  /**
+   * If this is true, the half timestep solves start from predictions
+   * built from the double-length solution instead of from the old
+   * solution: the midpoint of the old and double-length solutions for
+   * the first half step, and the double-length solution itself for
+   * the second.  These are usually much closer to the converged half
+   * step solutions, so the nonlinear solver needs fewer iterations.
+   *
+   * Defaults to false, so that results don't change with the initial
+   * guess in solves which aren't converged tightly.
+   */
+  bool predict_half_steps;
 };
 
 
@@ -240,6 +240,18 @@ public:
 
 private:
 
+  /**
+   * Fills \p key with the element types, the side, the quadrature
+   * rule and the neighbor's local index of each node on the current
+   * side, if the current side and a side of the neighbor have exactly
+   * the same nodes.
+   *
+   * \returns \p false if the face is not conforming in that sense, or if
+   * either element isn't Lagrange-mapped, in which case the neighbor
+   * quadrature points have to be found by inverse mapping.
+   */
+  bool conforming_face_key (std::vector<unsigned int> & key) const;
+
   /**
    * Current neighbor element for assembling DG terms.
    */
@@ -274,6 +286,19 @@ private:
   std::vector<dof_id_type> _neighbor_dof_indices;
   std::vector<std::vector<dof_id_type>> _neighbor_dof_indices_var;
 
+  /**
+   * Neighbor reference points of the side quadrature points.  On a
+   * conforming face both elements map the face from the same nodes,
+   * so these depend only on the \p conforming_face_key() and the
+   * Newton inverse map only has to be run once per key.
+   */
+  std::map<std::vector<unsigned int>, std::vector<Point>> _neighbor_qp_cache;
+
+  /**
+   * Scratch key, kept to avoid reallocating it on every face.
+   */
+  std::vector<unsigned int> _neighbor_qp_key;
+
   /**
    * Finite element objects for each variable's
    * sides on the neighbor element.
@@ -473,6 +473,23 @@ public:
   bool & is_adjoint()
   { return _is_adjoint; }
 
+  /**
+   * Accessor for querying whether only the diagonal of the element
+   * jacobian will be used, e.g. by FEMSystem::jacobian_diagonal().
+   * Physics kernels may then skip computing off-diagonal jacobian
+   * entries.  This is never set on elements with constrained dofs,
+   * whose constrained diagonal depends on the whole jacobian.
+   */
+  bool jacobian_diagonal_only() const
+  { return _jacobian_diagonal_only; }
+
+  /**
+   * Accessor for setting whether only the diagonal of the element
+   * jacobian will be used.
+   */
+  bool & jacobian_diagonal_only()
+  { return _jacobian_diagonal_only; }
+
   /**
    * For time-dependent problems, this is the time t for which the current
    * nonlinear_solution is defined.
@@ -664,6 +681,11 @@ private:
    */
   bool _is_adjoint;
 
+  /**
+   * Will only the diagonal of the element jacobian be used?
+   */
+  bool _jacobian_diagonal_only;
+
 };
 
 } // namespace libMesh
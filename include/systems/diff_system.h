@@ -138,6 +138,13 @@ public:
                          bool apply_heterogeneous_constraints = false,
                          bool apply_no_constraints = false) override = 0;
 
+  /**
+   * \returns \p true if assembly() brings \p current_local_solution
+   * up to date itself, so that solvers needn't call update()
+   * immediately beforehand.  The default is \p false.
+   */
+  virtual bool assembly_calls_update () const { return false; }
+
   /**
    * Invokes the solver associated with the system.  For steady state
    * solvers, this will find a root x where F(x) = 0.  For transient
@@ -87,7 +87,8 @@ public:
   enum WriteFlags { WRITE_DATA             = 1,
                     WRITE_ADDITIONAL_DATA  = 2,
                     WRITE_PARALLEL_FILES   = 4,
-                    WRITE_SERIAL_FILES     = 8 };
+                    WRITE_SERIAL_FILES     = 8,
+                    WRITE_CHUNKED_FILES    = 16 };
 
   /**
    * Constructor.
@@ -136,6 +137,26 @@ public:
    */
   virtual void enable_default_ghosting (bool enable);
 
+  /**
+   * Enable or disable minimal ghosting.  Minimal ghosting is disabled
+   * by default.  If enabled, the default ghosting functor is removed
+   * from the Mesh, and the default algebraic ghosting functor is
+   * removed from all Systems (including any later added systems),
+   * but the default coupling functors are kept.  A DistributedMesh
+   * can then drop its layer of point-neighbor ghost elements, and
+   * each send_list is left with only the non-local dofs on local
+   * elements, i.e. the dofs on nodes shared with other processors.
+   *
+   * This is intended for explicit solves with lumped mass matrices,
+   * where vertex-sharing dofs are all that need to be exchanged.  It
+   * is only safe for codes which do no evaluations on neighbor cells.
+   * It takes effect the next time the mesh deletes remote elements
+   * and the systems are (re)initialized.
+   *
+   * Calling enable_default_ghosting() replaces this setting.
+   */
+  virtual void enable_minimal_ghosting (bool enable);
+
   /**
    * Updates local values for all the systems
    */
@@ -457,6 +478,12 @@ public:
    * files written using "n" mpi processes can be re-read on "m" mpi
    * processes.  This renumbering is not compatible with meshes
    * that have two nodes in exactly the same position!
+   *
+   * Files written with WRITE_CHUNKED_FILES are detected from their
+   * header; their data is read from the chunked files alongside
+   * \p name, see System::read_chunked_data().  When reading from an
+   * \p Xdr object, \p chunked_basename must then be the name the
+   * files were written with.
    */
   template <typename InValType = Number>
   void read (std::string_view name,
@@ -473,7 +500,8 @@ public:
   void read (Xdr & io,
              std::function<std::unique_ptr<Xdr>()> & local_io_functor,
              const unsigned int read_flags=(READ_HEADER | READ_DATA),
-             bool partition_agnostic = true);
+             bool partition_agnostic = true,
+             std::string_view chunked_basename = "");
 
   /**
    * Write the systems to disk using the XDR data format.
@@ -498,6 +526,13 @@ public:
    * files written using "n" mpi processes can be re-read on "m" mpi
    * processes.  This renumbering is not compatible with meshes
    * that have two nodes in exactly the same position!
+   *
+   * With WRITE_CHUNKED_FILES, \p name only holds the header, and the
+   * data of the NNNNth system is written by
+   * System::write_chunked_data() to a compressed, chunked file
+   * \p name.chunks.NNNN which every processor writes its own part of.  When writing to an \p Xdr
+   * object, \p chunked_basename gives the name to use in place of
+   * \p name.
    */
   void write (std::string_view name,
               const XdrMODE,
@@ -515,7 +550,8 @@ public:
   void write (Xdr & io,
               const unsigned int write_flags=(WRITE_DATA),
               bool partition_agnostic = true,
-              Xdr * const local_io = nullptr) const;
+              Xdr * const local_io = nullptr,
+              std::string_view chunked_basename = "") const;
 
   /**
    * \returns \p true when this equation system contains
@@ -539,6 +575,20 @@ public:
    */
   void print_info (std::ostream & os=libMesh::out) const;
 
+  /**
+   * \returns Tables of the estimated memory used by the mesh and by
+   * each system, with the minimum and maximum per processor and the
+   * totals over all processors.  This must be called on all
+   * processors at once.
+   */
+  std::string get_memory_info () const;
+
+  /**
+   * Prints the tables from get_memory_info(), by default to
+   * libMesh::out.
+   */
+  void print_memory_info (std::ostream & os=libMesh::out) const;
+
   /**
    * Same as above, but allows you to also use stream syntax.
    */
@@ -620,6 +670,13 @@ protected:
    */
   bool _enable_default_ghosting;
 
+  /**
+   * Flag for whether to enable only minimal ghosting on newly added
+   * Systems.
+   * Default value: false
+   */
+  bool _enable_minimal_ghosting;
+
 private:
   /**
    * This function is used in the implementation of add_system,
@@ -634,6 +691,12 @@ private:
    * shim lets us forward-declare DofMap.
    */
   void _remove_default_ghosting(unsigned int sys_num);
+
+  /**
+   * This removes the default algebraic ghosting functor from
+   * DofMap, but using a shim lets us forward-declare DofMap.
+   */
+  void _remove_default_algebraic_ghosting(unsigned int sys_num);
 };
 
 
@@ -678,6 +741,8 @@ T_sys & EquationSystems::add_system (std::string_view name)
 
       if (!_enable_default_ghosting)
         this->_remove_default_ghosting(sys_num);
+      else if (_enable_minimal_ghosting)
+        this->_remove_default_algebraic_ghosting(sys_num);
 
       // Tell all the \p DofObject entities to add a system.
       this->_add_system_to_nodes_and_elems();
@@ -31,6 +31,11 @@
 #include "libmesh/tensor_value.h"
 #endif
 
+#ifdef LIBMESH_HAVE_METAPHYSICL
+#include "metaphysicl/dualnumber_decl.h"
+#include "metaphysicl/dynamicsparsenumberarray_decl.h"
+#endif
+
 // C++ includes
 #include <map>
 #include <set>
@@ -41,6 +46,7 @@ namespace libMesh
 // Forward Declarations
 class BoundaryInfo;
 class Elem;
+class GeometryCache;
 template <typename T> class FEGenericBase;
 typedef FEGenericBase<Real> FEBase;
 class QBase;
@@ -107,6 +113,27 @@ public:
    */
   void use_unweighted_quadrature_rules(int extra_quadrature_order=0);
 
+  /**
+   * Use the lowest order quadrature rules which exactly integrate
+   * products of basis functions with \p n_derivatives derivatives in
+   * total (0 for mass matrices, 2 for stiffness matrices) on affine
+   * elements, plus \p extra_quadrature_order.  See
+   * FEType::affine_quadrature_rule().
+   *
+   * These rules are only used for element dimensions in which every
+   * active local element has an affine map, e.g. meshes of Tri3 or
+   * Tet4 elements.  Otherwise we fall back on the default rules.
+   */
+  void use_affine_quadrature_rules(unsigned int n_derivatives=0,
+                                   int extra_quadrature_order=0);
+
+  /**
+   * Tells the element and side FE objects to save and reuse their
+   * mapping data in \p cache (or to stop doing so, if \p cache is
+   * nullptr).  See FEAbstract::set_geometry_cache().
+   */
+  void set_geometry_cache(GeometryCache * cache);
+
   /**
    * Reports if the boundary id is found on the current side
    */
@@ -240,6 +267,61 @@ public:
    */
   Gradient fixed_point_gradient(unsigned int var, const Point & p) const;
 
+#ifdef LIBMESH_HAVE_METAPHYSICL
+  /**
+   * Forward-mode automatic differentiation types for element
+   * kernels.  Derivative index \p j refers to entry \p j of the
+   * element solution vector, so a residual computed from these
+   * values carries its row of the element Jacobian with it.
+   */
+  typedef MetaPhysicL::DualNumber<Number, MetaPhysicL::DynamicSparseNumberArray<Number, unsigned int>> ADNumber;
+  typedef VectorValue<ADNumber> ADGradient;
+
+  /**
+   * \returns The value of the solution variable \p var at the
+   * quadrature point \p qp on the current element interior, along
+   * with its derivatives with respect to the element solution
+   * coefficients, scaled by get_elem_solution_derivative().
+   */
+  ADNumber interior_ad_value(unsigned int var, unsigned int qp) const;
+
+  /**
+   * \returns The gradient of the solution variable \p var at the
+   * quadrature point \p qp on the current element interior, with
+   * derivatives as in interior_ad_value().
+   */
+  ADGradient interior_ad_gradient(unsigned int var, unsigned int qp) const;
+
+  /**
+   * \returns The value of the solution variable \p var at the
+   * quadrature point \p qp on the current element side, with
+   * derivatives as in interior_ad_value().
+   */
+  ADNumber side_ad_value(unsigned int var, unsigned int qp) const;
+
+  /**
+   * \returns The gradient of the solution variable \p var at the
+   * quadrature point \p qp on the current element side, with
+   * derivatives as in interior_ad_value().
+   */
+  ADGradient side_ad_gradient(unsigned int var, unsigned int qp) const;
+
+  /**
+   * Adds the value of \p r to entry \p i of the element residual for
+   * variable \p var and, if \p request_jacobian is true, adds its
+   * derivatives to the matching row of the element Jacobian.
+   *
+   * A residual kernel evaluated on the *_ad_value() and
+   * *_ad_gradient() results and accumulated here gets its exact
+   * element Jacobian in the same pass, instead of from the
+   * finite-differenced FEMSystem::numerical_elem_jacobian().
+   */
+  void add_ad_residual(unsigned int var,
+                       unsigned int i,
+                       const ADNumber & r,
+                       bool request_jacobian);
+#endif // LIBMESH_HAVE_METAPHYSICL
+
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
   /**
    * \returns The hessian of the fixed_solution variable \p var at the quadrature
@@ -436,6 +518,22 @@ public:
                           const NumericVector<Number> & _system_vector,
                           std::vector<OutputType> & interior_gradients_vector) const;
 
+  /**
+   * Fills \p u_vals, and \p du_vals if it is non-null, with the values
+   * and gradients of every solution variable at every quadrature
+   * point in the current element interior.  The results are stored
+   * variable by variable: the entry for variable \p var at quadrature
+   * point \p qp is at index var*n_qp + qp, where
+   * n_qp = get_element_qrule().n_points().
+   *
+   * Each variable is evaluated in a single pass over its shape
+   * functions, which is cheaper than calling interior_value() and
+   * interior_gradient() at each quadrature point.  Only scalar-valued
+   * variables are supported.
+   */
+  void interior_values_and_gradients(std::vector<Number> & u_vals,
+                                     std::vector<Gradient> * du_vals = nullptr) const;
+
   /**
    * \returns The gradient of the solution variable \p var at the quadrature
    * point \p qp on the current element side.
@@ -1073,6 +1171,20 @@ protected:
    */
   const NumericVector<Number> * _custom_solution;
 
+  /**
+   * The algebraic type, the set of per-element vectors in use, and
+   * each variable's dof count as of the last pre_fe_reinit() which
+   * positioned the subvector and submatrix views; while these are
+   * unchanged the views don't need to be repositioned.
+   */
+  std::vector<unsigned int> _reinit_layout;
+
+  /**
+   * Workspace for building the current element's layout, to be
+   * compared with \p _reinit_layout
+   */
+  std::vector<unsigned int> _reinit_layout_scratch;
+
   mutable std::unique_ptr<FEGenericBase<Real>>         _real_fe;
   mutable std::unique_ptr<FEGenericBase<RealGradient>> _real_grad_fe;
   mutable int _real_fe_derivative_level;
@@ -1149,6 +1261,15 @@ protected:
            diff_subsolution_getter subsolution_getter>
   void some_gradient(unsigned int var, unsigned int qp, OutputType & u) const;
 
+#ifdef LIBMESH_HAVE_METAPHYSICL
+  /**
+   * Helper functions to reduce some code duplication in the *_ad_value
+   * and *_ad_gradient methods.
+   */
+  ADNumber some_ad_value(unsigned int var, unsigned int qp, const FEBase & fe) const;
+  ADGradient some_ad_gradient(unsigned int var, unsigned int qp, const FEBase & fe) const;
+#endif
+
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
   /**
    * Helper function to reduce some code duplication in the
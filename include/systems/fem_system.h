@@ -23,15 +23,21 @@
 // Local Includes
 #include "libmesh/diff_system.h"
 #include "libmesh/fem_physics.h"
+#include "libmesh/geometry_cache.h"
 
 // C++ includes
 #include <cstddef>
+#include <vector>
 
 namespace libMesh
 {
 
 // Forward Declarations
+class CouplingMatrix;
 class DiffContext;
+class Elem;
+class ErrorVector;
+template <typename T> class DiagonalMatrix;
 class FEMContext;
 
 
@@ -100,6 +106,57 @@ public:
                          bool apply_heterogeneous_constraints = false,
                          bool apply_no_constraints = false) override;
 
+  /**
+   * \returns \p overlap_ghost_update: when it is set, assembly()
+   * updates \p current_local_solution itself.
+   */
+  virtual bool assembly_calls_update () const override
+  { return overlap_ghost_update; }
+
+  /**
+   * Sets \p dest to the product of the constrained jacobian which
+   * assembly(false, true) would build with \p arg, without
+   * assembling a global matrix: each element jacobian is computed,
+   * constrained and applied to the element's entries of \p arg in
+   * turn.
+   *
+   * Every call costs as much as a jacobian assembly, but needs no
+   * more memory than a few global vectors.  As in assembly(),
+   * \link current_local_solution \endlink is the linearization
+   * point.
+   */
+  void jacobian_vector_mult (NumericVector<Number> & dest,
+                             const NumericVector<Number> & arg);
+
+  /**
+   * Sets \p dest to the diagonal of the constrained jacobian which
+   * assembly(false, true) would build, without assembling a global
+   * matrix, e.g. for Jacobi or Chebyshev smoothing of a
+   * MatrixFreeSystemOperator.
+   */
+  void jacobian_diagonal (NumericVector<Number> & dest);
+
+  /**
+   * Assembles only the diagonal of the constrained jacobian which
+   * assembly(false, true) would build into \p diag.  No off-diagonal
+   * entries are inserted anywhere, and physics kernels are told via
+   * DiffContext::jacobian_diagonal_only() that they may skip
+   * computing them on elements without constrained dofs.
+   */
+  void assemble_jacobian_diagonal (DiagonalMatrix<Number> & diag);
+
+  /**
+   * Clears the element coloring used by threaded assembly, in
+   * addition to the usual functionality.
+   */
+  virtual void reinit () override;
+
+  /**
+   * Clears the element coloring used by threaded assembly, in
+   * addition to the usual functionality.
+   */
+  virtual void reinit_constraints () override;
+
   /**
    * Invokes the solver associated with the system.  For steady state
    * solvers, this will find a root x where F(x) = 0.  For transient
@@ -175,6 +232,151 @@ public:
    */
   bool fe_reinit_during_postprocess;
 
+  /**
+   * If color_threaded_assembly is true (it is false by default),
+   * threaded assembly() groups the active local elements into
+   * colors, such that no two elements of a color share a degree of
+   * freedom or any degree of freedom it is constrained in terms of.
+   * Colors are then assembled one at a time, and element
+   * contributions are added to the global matrix and vector without
+   * taking the assembly lock.
+   *
+   * This only takes effect when running with multiple threads, when
+   * the system has no SCALAR variables (which couple every element),
+   * and, if a jacobian is requested, when the system matrix
+   * supports_concurrent_disjoint_add().  The coloring is computed on
+   * first use and kept until the system is reinitialized.
+   */
+  bool color_threaded_assembly;
+
+  /**
+   * If batch_jacobian_assembly is true (it is false by default),
+   * assembly() stages each thread's constrained element jacobians
+   * instead of adding them to the global matrix one element at a
+   * time, then hands them all to the matrix in a single
+   * SparseMatrix::set_from_coo() call.  For PETSc matrices this uses
+   * the COO assembly interface, which avoids the per-call overhead of
+   * MatSetValues() on many small element matrices.
+   *
+   * This trades memory for speed, since every element jacobian is
+   * kept until the end of assembly.  It is ignored for systems with
+   * SCALAR variables and when color_threaded_assembly is in effect.
+   *
+   * \note With PETSc the matrix nonzero structure is replaced by the
+   * pattern of the element jacobians, so this should only be used
+   * when nothing else later adds entries outside that pattern.
+   */
+  bool batch_jacobian_assembly;
+
+  /**
+   * If locality_ordered_assembly is true (it is false by default),
+   * assembly() visits the active local elements along a space-filling
+   * curve (see MeshTools::sort_elems_by_locality()) rather than in
+   * storage order.  Each thread then gets a spatially compact chunk
+   * of elements, which improves cache reuse of their shared nodes and
+   * dofs and reduces concurrent writes to the same parts of the
+   * global matrix and vector.
+   *
+   * The ordering is computed on first use and kept until the system
+   * is reinitialized.  It does not affect color_threaded_assembly.
+   */
+  bool locality_ordered_assembly;
+
+  /**
+   * If type_ordered_assembly is true (it is false by default),
+   * assembly() visits the active local elements grouped by element
+   * type, p refinement level and subdomain (see
+   * MeshTools::sort_elems_by_type()).  On mixed meshes this lets the
+   * FE objects reuse their shape function data across runs of
+   * similar elements.  With locality_ordered_assembly also set, each
+   * group is in space-filling curve order.
+   *
+   * The ordering is computed on first use and kept until the system
+   * is reinitialized.  It does not affect color_threaded_assembly.
+   */
+  bool type_ordered_assembly;
+
+  /**
+   * If overlap_ghost_update is true (it is false by default),
+   * assembly() refreshes \p current_local_solution itself: it starts
+   * the ghost value exchange with begin_update(), assembles the local
+   * elements whose degrees of freedom (and any they are constrained
+   * in terms of) are all owned by this processor while the exchange
+   * is in flight, and finishes the exchange with end_update() before
+   * assembling the remaining elements.  Solvers then skip their own
+   * update() before assembly; see assembly_calls_update().
+   *
+   * The overlap is only done when color_threaded_assembly and
+   * batch_jacobian_assembly are not in effect and the system has no
+   * SCALAR variables; otherwise assembly() just calls update() first.
+   * The split of the elements is computed on first use and kept until
+   * the system is reinitialized.
+   */
+  bool overlap_ghost_update;
+
+  /**
+   * If record_elem_assembly_times is true (it is false by default),
+   * assembly() adds the wall time spent on each active local element
+   * to elem_assembly_times().  These can be turned into partitioner
+   * weights with elem_assembly_weights(), so that meshes whose
+   * elements differ greatly in cost are balanced by work rather than
+   * by element count.
+   */
+  bool record_elem_assembly_times;
+
+  /**
+   * \returns The assembly time, in seconds, accumulated on each local
+   * element since the times were last cleared, indexed by element
+   * id.  Entries for elements this processor doesn't own are zero.
+   */
+  const std::vector<Real> & elem_assembly_times() const
+  { return _elem_assembly_times; }
+
+  /**
+   * Discards the recorded element assembly times, e.g. after the mesh
+   * has been refined or repartitioned.
+   */
+  void clear_elem_assembly_times()
+  { _elem_assembly_times.clear(); }
+
+  /**
+   * Fills \p weights, for Partitioner::attach_weights(), with one
+   * weight per element proportional to its recorded assembly time.
+   * Weights are scaled so that their mean over timed elements is
+   * \p mean_weight, and are never less than 1; elements with no
+   * recorded time get \p mean_weight.  The result is the same on
+   * every processor, so this must be called on all of them.
+   */
+  void elem_assembly_weights (ErrorVector & weights,
+                              Real mean_weight = 100) const;
+
+  /**
+   * If cache_element_geometry is true (it is false by default), the
+   * element and side FE objects of contexts built by build_context()
+   * save the mapping data (JxW, xyz, map derivatives, normals) they
+   * compute at their quadrature points in geometry_cache(), and
+   * reuse it on later evaluations on the same element instead of
+   * recomputing it.  This saves recomputing identical geometry on
+   * every residual and jacobian evaluation of a nonlinear solve, at
+   * the cost of memory; see GeometryCache::memory_usage().
+   *
+   * The cache is cleared when the system is reinitialized and when
+   * mesh_position_set() moves the mesh.  It is not used by moving
+   * mesh systems, and users who move mesh nodes themselves must call
+   * geometry_cache().clear() afterwards.
+   */
+  bool cache_element_geometry;
+
+  /**
+   * \returns The cached element geometry used when
+   * \p cache_element_geometry is set.
+   */
+  GeometryCache & geometry_cache()
+  { return _geometry_cache; }
+
+  const GeometryCache & geometry_cache() const
+  { return _geometry_cache; }
+
   /**
    * If calculating numeric jacobians is required, the FEMSystem
    * will perturb each solution vector entry by numerical_jacobian_h
@@ -214,6 +416,20 @@ public:
    */
   Real verify_analytic_jacobians;
 
+  /**
+   * If numerical_jacobian_coloring is true (it is false by default),
+   * numerical jacobians perturb a dof of every variable in a group
+   * at once, where no variable's residual is coupled (per the
+   * DofMap's CouplingMatrix) to more than one variable in the
+   * group.  With a sparse CouplingMatrix this takes fewer residual
+   * evaluations per element; without one, or on a moving mesh
+   * system, it has no effect.
+   *
+   * The residual kernels must actually respect the CouplingMatrix,
+   * or the resulting jacobians will be wrong.
+   */
+  bool numerical_jacobian_coloring;
+
   /**
    * Syntax sugar to make numerical_jacobian() declaration easier.
    */
@@ -255,7 +471,62 @@ protected:
   virtual void init_data () override;
 
 private:
+  /**
+   * Implements numerical_jacobian() when numerical_jacobian_coloring
+   * applies, perturbing the variables in each group of
+   * \p var_colors together.
+   */
+  void colored_numerical_jacobian (TimeSolverResPtr res,
+                                   FEMContext & context,
+                                   const CouplingMatrix & coupling,
+                                   const std::vector<std::vector<unsigned int>> & var_colors) const;
+
+  /**
+   * Implements jacobian_vector_mult() given an already localized
+   * \p local_arg, or jacobian_diagonal() if \p local_arg is null.
+   */
+  void jacobian_action (const NumericVector<Number> * local_arg,
+                        NumericVector<Number> & dest);
+
   std::vector<Real> _numerical_jacobian_h_for_var;
+
+  /**
+   * The element colors used by threaded assembly when
+   * \p color_threaded_assembly is set; empty until first needed.
+   */
+  std::vector<std::vector<const Elem *>> _assembly_colors;
+
+  /**
+   * The active local elements in the order used by assembly when
+   * \p locality_ordered_assembly or \p type_ordered_assembly is set;
+   * empty until first needed.
+   */
+  std::vector<const Elem *> _assembly_elem_order;
+
+  /**
+   * The settings of \p locality_ordered_assembly and
+   * \p type_ordered_assembly which \p _assembly_elem_order was built
+   * with.
+   */
+  bool _assembly_elem_order_by_locality, _assembly_elem_order_by_type;
+
+  /**
+   * The active local elements which only need locally owned values,
+   * and the rest, when \p overlap_ghost_update is set; empty until
+   * first needed.
+   */
+  std::vector<const Elem *> _owned_dof_elems, _ghosted_dof_elems;
+
+  /**
+   * Per-element assembly times, when \p record_elem_assembly_times
+   * is set.
+   */
+  std::vector<Real> _elem_assembly_times;
+
+  /**
+   * Per-element mapping data, when \p cache_element_geometry is set.
+   */
+  GeometryCache _geometry_cache;
 };
 
 // --------------------------------------------------------------
@@ -113,7 +113,9 @@ public:
    * frequencies. The solution vectors are stored in automatically
    * allocated vectors named \p solution_nnnn.  For access to these vectors,
    * see \p System. When calling this, the frequency range should
-   * already be set.
+   * already be set.  When the sweep is shared between several groups
+   * of processors, each group only solves for its own contiguous block
+   * of this range.
    */
   void solve (const unsigned int n_start,
               const unsigned int n_stop);
@@ -199,6 +201,58 @@ public:
    */
   std::pair<unsigned int, Real> get_rval (unsigned int n) const;
 
+  /**
+   * Splits \p sweep_comm into \p n_groups contiguous groups of
+   * processors, and sets \p group_comm to the group this processor
+   * belongs to.  Building the mesh, the \p EquationSystems and this
+   * system on \p group_comm, followed by a call to
+   * \p set_frequency_sweep_communicator(sweep_comm), lets each group
+   * solve its own share of the frequencies concurrently.
+   */
+  static void split_frequency_groups (const Parallel::Communicator & sweep_comm,
+                                      const unsigned int n_groups,
+                                      Parallel::Communicator & group_comm);
+
+  /**
+   * Tells this system that identical copies of it live on disjoint
+   * groups of the processors in \p sweep_comm, each group using its
+   * own communicator.  Subsequent calls to \p solve() then only solve
+   * for a contiguous block of the requested frequencies on each
+   * group, so that all groups sweep concurrently.  The
+   * frequency-independent matrices are assembled once per group as
+   * usual.
+   *
+   * Only the solution duplicates and \p get_rval() entries for the
+   * frequencies solved by this group are filled once \p solve()
+   * returns; \p frequency_group() identifies which group owns a given
+   * frequency.
+   */
+  void set_frequency_sweep_communicator (const Parallel::Communicator & sweep_comm);
+
+  /**
+   * \returns The number of processor groups sharing the frequency
+   * sweep; 1 unless \p set_frequency_sweep_communicator() has been
+   * called.
+   */
+  unsigned int n_frequency_groups () const { return _n_frequency_groups; }
+
+  /**
+   * \returns The group of processors which solves for the \p n-th
+   * frequency when \p solve() is called for the full frequency range.
+   */
+  unsigned int frequency_group (const unsigned int n) const;
+
+  /**
+   * When \p reuse is true, the preconditioner built for the first
+   * frequency a group solves is kept for the neighbouring frequencies
+   * that group solves next, and is only rebuilt every \p rebuild_interval
+   * frequencies.  A \p rebuild_interval of 0 never rebuilds it during a
+   * sweep.  This pays off when the frequency step is small compared to
+   * the frequencies themselves.  Off by default.
+   */
+  void reuse_preconditioner_across_frequencies (const bool reuse,
+                                                const unsigned int rebuild_interval = 0);
+
   /**
    * \returns A string of the form \p "frequency_x", where \p x is
    * the integer \p n.  Useful for identifying frequencies and
@@ -274,6 +328,30 @@ protected:
    */
   std::vector<std::pair<unsigned int, Real>> vec_rval;
 
+private:
+
+  /**
+   * \returns The half-open range of frequencies in
+   * \f$ [ \texttt{n\_start, n\_stop} ] \f$ this processor's group
+   * solves for.
+   */
+  std::pair<unsigned int, unsigned int>
+  local_frequency_range (const unsigned int n_start,
+                         const unsigned int n_stop) const;
+
+  /**
+   * The number of processor groups sharing the frequency sweep, and
+   * the group this processor belongs to.
+   */
+  unsigned int _n_frequency_groups;
+  unsigned int _frequency_group;
+
+  /**
+   * Whether, and how often, preconditioners are reused between
+   * neighbouring frequencies.
+   */
+  bool _reuse_frequency_preconditioner;
+  unsigned int _preconditioner_rebuild_interval;
 };
 
 
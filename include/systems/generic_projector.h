@@ -21,6 +21,7 @@
 #define GENERIC_PROJECTOR_H
 
 // C++ includes
+#include <atomic>
 #include <vector>
 
 // libMesh includes
@@ -112,12 +113,10 @@ public:
     variables(variables_in),
     nodes_to_elem(nodes_to_elem_in)
   {
+    // We fill this map in project(), and only if we need it
     if (map_was_created) // past tense misnomer here
-      {
-        nodes_to_elem = new
-          std::unordered_map<dof_id_type, std::vector<dof_id_type>>;
-        MeshTools::build_nodes_to_elem_map (system.get_mesh(), *nodes_to_elem);
-      }
+      nodes_to_elem = new
+        std::unordered_map<dof_id_type, std::vector<dof_id_type>>;
   }
 
   GenericProjector (const GenericProjector & in) :
@@ -372,6 +371,32 @@ public:
     void operator() (const interior_range & range);
   };
 
+  // When every variable being projected is a Lagrange variable active
+  // on the whole mesh, every dof is a nodal value which the owner of
+  // its node can compute from any of its local elements.  We can then
+  // project everything in a single threaded pass over elements,
+  // evaluating each node once, with no multimaps of work to sort and
+  // no dof values to save or communicate between stages.
+  bool nodal_values_only() const;
+
+  struct ProjectNodalValues : public SubFunctor {
+    ProjectNodalValues (GenericProjector & p) : SubFunctor(p) {}
+
+    ProjectNodalValues (ProjectNodalValues & p_n, Threads::split) : SubFunctor(p_n.projector) {}
+
+    using SubFunctor::action;
+    using SubFunctor::f;
+    using SubFunctor::system;
+    using SubFunctor::context;
+    using SubFunctor::insert_id;
+
+    void operator() (const ConstElemRange & range);
+  };
+
+  // One flag per node id, set by whichever thread first claims that
+  // node in ProjectNodalValues, so no node is evaluated twice.
+  std::vector<std::atomic<bool>> node_claimed;
+
   template <typename Value>
   void send_and_insert_dof_values
     (std::unordered_map<dof_id_type, std::pair<Value, processor_id_type>> & ids_to_push,
@@ -797,11 +822,11 @@ public:
     // this node (e.g. due to changing subdomain support)
     const DofObject * old_dof_object = n.get_old_dof_object();
     if (old_dof_object &&
-        old_dof_object->n_vars(this->sys.number()) &&
-        old_dof_object->n_comp(this->sys.number(), var))
+        old_dof_object->n_vars(this->sys.get_dof_map().sys_number()) &&
+        old_dof_object->n_comp(this->sys.get_dof_map().sys_number(), var))
       {
         const dof_id_type first_old_id =
-          old_dof_object->dof_number(this->sys.number(), var, dim);
+          old_dof_object->dof_number(this->sys.get_dof_map().sys_number(), var, dim);
         std::vector<dof_id_type> old_ids(n_mixed);
         std::iota(old_ids.begin(), old_ids.end(), first_old_id);
         old_solution.get(old_ids, derivs);
@@ -1041,11 +1066,11 @@ eval_at_node(const FEMContext & c,
       (!extra_hanging_dofs ||
        flag == Elem::JUST_COARSENED ||
        flag == Elem::DO_NOTHING) &&
-      old_dof_object->n_vars(sys.number()) &&
-      old_dof_object->n_comp(sys.number(), var))
+      old_dof_object->n_vars(sys.get_dof_map().sys_number()) &&
+      old_dof_object->n_comp(sys.get_dof_map().sys_number(), var))
     {
       const dof_id_type old_id =
-        old_dof_object->dof_number(sys.number(), var, 0);
+        old_dof_object->dof_number(sys.get_dof_map().sys_number(), var, 0);
       return old_solution(old_id);
     }
 
@@ -1092,15 +1117,15 @@ eval_at_node(const FEMContext & c,
       (!extra_hanging_dofs ||
        flag == Elem::JUST_COARSENED ||
        flag == Elem::DO_NOTHING) &&
-      old_dof_object->n_vars(sys.number()) &&
-      old_dof_object->n_comp(sys.number(), var))
+      old_dof_object->n_vars(sys.get_dof_map().sys_number()) &&
+      old_dof_object->n_comp(sys.get_dof_map().sys_number(), var))
     {
       Gradient return_val;
 
       for (auto dim : make_range(elem.dim()))
       {
         const dof_id_type old_id =
-          old_dof_object->dof_number(sys.number(), var, dim);
+          old_dof_object->dof_number(sys.get_dof_map().sys_number(), var, dim);
         return_val(dim) = old_solution(old_id);
       }
 
@@ -1150,14 +1175,14 @@ eval_at_node(const FEMContext & c,
       (!extra_hanging_dofs ||
        flag == Elem::JUST_COARSENED ||
        flag == Elem::DO_NOTHING) &&
-      old_dof_object->n_vars(sys.number()) &&
-      old_dof_object->n_comp(sys.number(), var))
+      old_dof_object->n_vars(sys.get_dof_map().sys_number()) &&
+      old_dof_object->n_comp(sys.get_dof_map().sys_number(), var))
     {
       Gradient g;
       for (unsigned int d = 0; d != elem_dim; ++d)
         {
           const dof_id_type old_id =
-            old_dof_object->dof_number(sys.number(), var, d+1);
+            old_dof_object->dof_number(sys.get_dof_map().sys_number(), var, d+1);
           g(d) = old_solution(old_id);
         }
       return g;
@@ -1202,6 +1227,26 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::project
 {
   LOG_SCOPE ("project", "GenericProjector");
 
+  if (this->nodal_values_only())
+    {
+      // Nothing computed here is needed by a later stage
+      done_saving_ids = true;
+
+      std::vector<std::atomic<bool>>
+        (system.get_mesh().max_node_id()).swap(node_claimed);
+
+      ProjectNodalValues project_nodal_values(*this);
+      Threads::parallel_reduce (range, project_nodal_values);
+
+      std::vector<std::atomic<bool>>().swap(node_claimed);
+      return;
+    }
+
+  // An empty map is ours to fill, or was given to us to fill so
+  // that other projections can share it
+  if (nodes_to_elem->empty())
+    MeshTools::build_nodes_to_elem_map (system.get_mesh(), *nodes_to_elem);
+
   // Unless we split sort and copy into two passes we can't know for
   // sure ahead of time whether we need to save the copied ids
   done_saving_ids = false;
@@ -1267,6 +1312,90 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::project
 }
 
 
+template <typename FFunctor, typename GFunctor,
+          typename FValue, typename ProjectionAction>
+bool GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::nodal_values_only() const
+{
+  for (auto v_num : variables)
+    {
+      const Variable & var = system.variable(v_num);
+
+      // SCALAR dofs are handled outside of the projector
+      if (var.type().family == SCALAR)
+        continue;
+
+      if (var.type().family != LAGRANGE ||
+          !var.implicitly_active())
+        return false;
+    }
+
+  return !variables.empty();
+}
+
+
+template <typename FFunctor, typename GFunctor,
+          typename FValue, typename ProjectionAction>
+void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectNodalValues::operator()
+  (const ConstElemRange & range)
+{
+  LOG_SCOPE ("project_nodal_values","GenericProjector");
+
+  const unsigned int sys_num = system.get_dof_map().sys_number();
+  const processor_id_type my_pid = system.processor_id();
+
+  std::vector<unsigned int> my_nodes;
+
+  for (const auto & elem : range)
+    {
+#ifdef LIBMESH_ENABLE_AMR
+      // As in SortAndCopy: newly added elements are the user's
+      // responsibility during a grid projection
+      if (f.is_grid_projection() &&
+          !elem->get_old_dof_object() &&
+          elem->refinement_flag() != Elem::JUST_REFINED &&
+          elem->refinement_flag() != Elem::JUST_COARSENED)
+        continue;
+#endif // LIBMESH_ENABLE_AMR
+
+      // Each node is projected by its owner, from the first local
+      // element to claim it.  Since every variable here is active
+      // everywhere, the owner can compute all of that node's dofs.
+      my_nodes.clear();
+      for (auto n : make_range(elem->n_nodes()))
+        {
+          const Node & node = elem->node_ref(n);
+          if (node.processor_id() == my_pid &&
+              !this->projector.node_claimed[node.id()].exchange(true))
+            my_nodes.push_back(n);
+        }
+
+      if (my_nodes.empty())
+        continue;
+
+      context.pre_fe_reinit(system, elem);
+
+      for (auto n : my_nodes)
+        {
+          const Node & node = elem->node_ref(n);
+
+          for (auto var : this->projector.variables)
+            {
+              if (system.variable(var).type().family == SCALAR ||
+                  !node.n_comp(sys_num, var))
+                continue;
+
+              const FValue val = f.eval_at_node
+                (context, system.variable_scalar_number(var, 0),
+                 /*dim=*/ 0, node, /*extra_hanging_dofs=*/ false,
+                 system.time);
+
+              insert_id(node.dof_number(sys_num, var, 0), val, my_pid);
+            }
+        }
+    }
+}
+
+
 template <typename FFunctor, typename GFunctor,
           typename FValue, typename ProjectionAction>
 GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::SubFunctor::SubFunctor
@@ -1495,7 +1624,7 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::SortAndCopy
   // nodes.
   std::unordered_map<const Node *, std::pair<var_set, var_set>> copied_nodes;
 
-  const unsigned int sys_num = system.number();
+  const unsigned int sys_num = system.get_dof_map().sys_number();
 
   // At hanging nodes for variables with extra hanging dofs we'll need
   // to do projections *separately* from vertex elements and side/edge
@@ -2003,7 +2132,7 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectVert
 {
   LOG_SCOPE ("project_vertices","GenericProjector");
 
-  const unsigned int sys_num = system.number();
+  const unsigned int sys_num = system.get_dof_map().sys_number();
 
   // Variables with extra hanging dofs can't safely use eval_at_node
   // in as many places as variables without can.
@@ -2327,7 +2456,7 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectEdge
 {
   LOG_SCOPE ("project_edges","GenericProjector");
 
-  const unsigned int sys_num = system.number();
+  const unsigned int sys_num = system.get_dof_map().sys_number();
 
   for (const auto & e_pair : range)
     {
@@ -2494,7 +2623,7 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectSide
 {
   LOG_SCOPE ("project_sides","GenericProjector");
 
-  const unsigned int sys_num = system.number();
+  const unsigned int sys_num = system.get_dof_map().sys_number();
 
   for (const auto & s_pair : range)
     {
@@ -2683,7 +2812,7 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectInte
 {
   LOG_SCOPE ("project_interiors","GenericProjector");
 
-  const unsigned int sys_num = system.number();
+  const unsigned int sys_num = system.get_dof_map().sys_number();
 
   // Iterate over all dof-bearing element interiors in the range
   for (const auto & elem : range)
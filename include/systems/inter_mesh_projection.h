@@ -32,6 +32,8 @@
 
 // C++ includes
 #include <cstddef>
+#include <map>
+#include <memory>
 #include <vector>
 
 namespace libMesh
@@ -53,9 +55,19 @@ public:
   // projected onto the _to_mesh
   InterMeshProjection(System & _from_system, System & _to_mesh);
 
-  // Projects from_system vectors onto the to_mesh
+  // Projects from_system vectors onto the to_mesh.
+  //
+  // The first call records every point at which the projection
+  // evaluates from_system, locates them all in one spatially sorted
+  // pass, and stores the interpolation weights there.  Every vector,
+  // in this and later calls, is then projected from those stored
+  // weights.  Call clear_transfer() before projecting again if either
+  // mesh or dof numbering has changed.
   void project_system_vectors();
 
+  // Discards the transfer data stored by project_system_vectors()
+  void clear_transfer();
+
   static Number fptr(const Point & p, const Parameters &, const std::string & libmesh_dbg_var(sys_name), const std::string & unknown_name);
 
   static Gradient gptr(const Point & p, const Parameters &, const std::string & libmesh_dbg_var(sys_name), const std::string & unknown_name);
@@ -68,6 +80,29 @@ private:
   // Local copy of the _to_system
   System & to_system;
 
+  // Builds the transfer data for the given from_system variables
+  void build_transfer(const std::vector<unsigned int> & variables);
+
+  // Projects the values in from_values onto to_vector
+  void project_from_values(NumericVector<Number> & to_vector,
+                           int is_adjoint);
+
+  // A serial copy of the from_system vector being projected
+  std::unique_ptr<NumericVector<Number>> from_values;
+
+  // A MeshFunction of from_values which stores the interpolation
+  // weights at the recorded points
+  std::unique_ptr<MeshFunction> transfer_function;
+
+  // A MeshFunction of from_values for gradients, and for any point
+  // which wasn't recorded
+  std::unique_ptr<MeshFunction> from_function;
+
+  // The index of each recorded point, and the values of every
+  // variable there
+  std::map<Point, std::size_t> point_index;
+  std::vector<Number> point_values;
+
 };
 
 // This class provides the functor we will supply to System::project_vector
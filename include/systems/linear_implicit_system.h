@@ -22,6 +22,7 @@
 
 // Local Includes
 #include "libmesh/implicit_system.h"
+#include "libmesh/mixed_precision_refinement.h"
 
 // C++ includes
 #include <cstddef>
@@ -159,6 +160,63 @@ public:
    */
   Real final_linear_residual() const { return _final_linear_residual; }
 
+  /**
+   * Lets solve() decide when to rebuild the preconditioner.  When
+   * \p reuse is true, the preconditioner built by one solve is reused
+   * by the solves after it, until a solve takes more than
+   * \p max_iteration_growth times as many iterations as the solve
+   * which built it; the solve after that builds a new one.  Changes to
+   * the system size (reinit()) or to the solved subset also force a
+   * rebuild.  This overrides the linear solver's own
+   * reuse_preconditioner() setting.
+   *
+   * Solves which build a preconditioner are logged as "solve() with new
+   * preconditioner", and the others as "solve() with reused
+   * preconditioner", in the performance log.
+   */
+  void set_adaptive_preconditioner_reuse (bool reuse,
+                                          Real max_iteration_growth = 2);
+
+  /**
+   * \returns Whether solve() decides when to rebuild the preconditioner.
+   */
+  bool adaptive_preconditioner_reuse () const
+  { return _adaptive_preconditioner_reuse; }
+
+  /**
+   * \returns The number of solves with adaptive preconditioner reuse
+   * which built a new preconditioner.
+   */
+  unsigned int n_preconditioner_rebuilds () const
+  { return _n_preconditioner_rebuilds; }
+
+  /**
+   * \returns The number of solves with adaptive preconditioner reuse
+   * which reused an old preconditioner.
+   */
+  unsigned int n_preconditioner_reuses () const
+  { return _n_preconditioner_reuses; }
+
+  /**
+   * Lets solve() replace the linear solver by a single precision LU
+   * factorization of \p matrix, with at most \p max_steps steps of
+   * iterative refinement in \p Number precision to reach the "linear
+   * solver tolerance" relative residual.  See
+   * \p MixedPrecisionRefinement for the requirements.
+   *
+   * With adaptive preconditioner reuse the factorization is treated
+   * as the preconditioner, and the refinement steps as iterations.
+   * Otherwise each solve factors the matrix anew.
+   */
+  void set_mixed_precision_refinement (bool enable,
+                                       unsigned int max_steps = 20);
+
+  /**
+   * \returns Whether solve() uses mixed precision refinement.
+   */
+  bool mixed_precision_refinement () const
+  { return _mixed_precision_refinement != nullptr; }
+
   /**
    * This function enables the user to provide a shell matrix, i.e. a
    * matrix that is not stored element-wise, but as a function.  When
@@ -199,6 +257,26 @@ protected:
    */
   ShellMatrix<Number> * _shell_matrix;
 
+  /**
+   * Whether solve() decides when to rebuild the preconditioner, and
+   * how much the iteration count may grow before it does.
+   */
+  bool _adaptive_preconditioner_reuse;
+  Real _preconditioner_max_iteration_growth;
+
+  /**
+   * The iteration count of the solve which built the current
+   * preconditioner, or \p libMesh::invalid_uint if the next solve
+   * has to build a new one.
+   */
+  unsigned int _preconditioner_build_iterations;
+
+  /**
+   * Counts of solves with new and with reused preconditioners.
+   */
+  unsigned int _n_preconditioner_rebuilds;
+  unsigned int _n_preconditioner_reuses;
+
   /**
    * The current subset on which to solve (or \p nullptr if none).
    */
@@ -209,6 +287,13 @@ protected:
    * what happens with the dofs outside the subset.
    */
   SubsetSolveMode _subset_solve_mode;
+
+  /**
+   * The single precision factorization used by solve(), if mixed
+   * precision refinement is enabled, and the refinement step limit.
+   */
+  std::unique_ptr<MixedPrecisionRefinement> _mixed_precision_refinement;
+  unsigned int _mixed_precision_max_steps;
 };
 
 } // namespace libMesh
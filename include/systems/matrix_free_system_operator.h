@@ -0,0 +1,95 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MATRIX_FREE_SYSTEM_OPERATOR_H
+#define LIBMESH_MATRIX_FREE_SYSTEM_OPERATOR_H
+
+// Local includes
+#include "libmesh/shell_matrix.h"
+
+namespace libMesh
+{
+
+// Forward declarations
+class FEMSystem;
+
+/**
+ * A ShellMatrix which applies the jacobian of an FEMSystem by
+ * evaluating its element kernels, via
+ * FEMSystem::jacobian_vector_mult(), rather than by assembling a
+ * sparse matrix.  Its diagonal is likewise computed element by
+ * element, so it can be used with Jacobi preconditioning or Chebyshev
+ * smoothing in a PetscLinearSolver shell solve.
+ *
+ * Set NewtonSolver::jacobian_operator to an object of this class to
+ * solve an FEMSystem without ever assembling its jacobian.  To avoid
+ * allocating a sparse system matrix at all, add the "System Matrix"
+ * with MatrixBuildType::DIAGONAL before the system is initialized.
+ *
+ * \brief Matrix-free jacobian of an FEMSystem.
+ */
+class MatrixFreeSystemOperator : public ShellMatrix<Number>
+{
+public:
+  /**
+   * Constructor; \p sys must outlive this object.
+   */
+  explicit
+  MatrixFreeSystemOperator (FEMSystem & sys);
+
+  virtual ~MatrixFreeSystemOperator () = default;
+
+  /**
+   * \returns \p m, the row-dimension of the matrix where the matrix
+   * is \f$ M \times N \f$.
+   */
+  virtual numeric_index_type m () const override;
+
+  /**
+   * \returns \p n, the column-dimension of the matrix where the matrix
+   * is \f$ M \times N \f$.
+   */
+  virtual numeric_index_type n () const override;
+
+  /**
+   * Multiplies the matrix with \p arg and stores the result in \p
+   * dest.
+   */
+  virtual void vector_mult (NumericVector<Number> & dest,
+                            const NumericVector<Number> & arg) const override;
+
+  /**
+   * Multiplies the matrix with \p arg and adds the result to \p dest.
+   */
+  virtual void vector_mult_add (NumericVector<Number> & dest,
+                                const NumericVector<Number> & arg) const override;
+
+  /**
+   * Copies the diagonal part of the matrix into \p dest.
+   */
+  virtual void get_diagonal (NumericVector<Number> & dest) const override;
+
+private:
+
+  FEMSystem & _sys;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MATRIX_FREE_SYSTEM_OPERATOR_H
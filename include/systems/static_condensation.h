@@ -0,0 +1,162 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_STATIC_CONDENSATION_H
+#define LIBMESH_STATIC_CONDENSATION_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+#include "libmesh/id_types.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <unordered_map>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class System;
+
+/**
+ * Static condensation of element interior degrees of freedom.
+ *
+ * With high order H1 elements (HIERARCHIC, BERNSTEIN, SZABAB, ...)
+ * the bubble functions stored on an element couple only to the other
+ * degrees of freedom of that element.  An assembly routine can pass
+ * each (already constrained) element matrix and vector to condense(),
+ * which replaces them with their Schur complement on the degrees of
+ * freedom shared with other elements, and with identity rows for the
+ * interior ones.  The global solve then only couples vertex, edge and
+ * face degrees of freedom.  After the solve, recover() computes the
+ * interior degrees of freedom element by element from the stored
+ * factorizations.
+ *
+ * The interior degrees of freedom are those stored on the element
+ * itself for continuous, non-SCALAR variables.  Discontinuous
+ * variables are left alone, since their element dofs couple across
+ * faces.  Element types which store bubble functions on an interior
+ * node instead (TRI7, HEX27 and the like) aren't condensed.  The
+ * sparsity pattern still has room for the interior couplings; it is
+ * the number of coupled unknowns the linear solver sees which
+ * shrinks.
+ *
+ * A typical assembly loop becomes
+ *
+ * \code
+ * condensation.clear();
+ * for (const Elem * elem : mesh.active_local_element_ptr_range())
+ *   {
+ *     ... compute Ke and Fe ...
+ *     dof_map.constrain_element_matrix_and_vector(Ke, Fe, dof_indices);
+ *     condensation.condense(*elem, Ke, Fe, dof_indices);
+ *     matrix.add_matrix(Ke, dof_indices);
+ *     rhs.add_vector(Fe, dof_indices);
+ *   }
+ * \endcode
+ *
+ * followed by \p condensation.recover() after each solve.  condense()
+ * may be called from threaded assembly loops.
+ */
+class StaticCondensation
+{
+public:
+  /**
+   * Constructor.  Interior dofs are found and recovered in \p system.
+   */
+  explicit
+  StaticCondensation (System & system);
+
+  /**
+   * Forgets the stored element data.  Call this before reassembling.
+   */
+  void clear ();
+
+  /**
+   * Condenses the interior degrees of freedom of \p elem out of the
+   * element matrix \p Ke and vector \p Fe, whose rows and columns
+   * correspond to \p dof_indices, and stores what recover() will
+   * need.  Rows and columns of interior dofs are replaced by ones of
+   * the identity, with zero right hand side.
+   */
+  void condense (const Elem & elem,
+                 DenseMatrix<Number> & Ke,
+                 DenseVector<Number> & Fe,
+                 const std::vector<dof_id_type> & dof_indices);
+
+  /**
+   * Sets the interior degrees of freedom of the system solution from
+   * the other degrees of freedom, which are read from the system's
+   * \p current_local_solution, and updates the system.
+   */
+  void recover ();
+
+  /**
+   * \returns The number of interior degrees of freedom condensed out
+   * on this processor since the last clear().
+   */
+  std::size_t n_condensed_dofs () const { return _n_condensed_dofs; }
+
+private:
+  /**
+   * What we need to recover an element's interior dofs.
+   */
+  struct ElemData
+  {
+    /**
+     * The global indices of the interior and of the other dofs.
+     */
+    std::vector<dof_id_type> interior_dofs, exterior_dofs;
+
+    /**
+     * The LU factored interior block of the element matrix.
+     */
+    DenseMatrix<Number> A_ii;
+
+    /**
+     * The interior-exterior coupling block of the element matrix.
+     */
+    DenseMatrix<Number> A_ie;
+
+    /**
+     * The interior part of the element vector.
+     */
+    DenseVector<Number> F_i;
+  };
+
+  System & _system;
+
+  std::unordered_map<dof_id_type, ElemData> _elem_data;
+
+  std::size_t _n_condensed_dofs;
+
+  /**
+   * Guards _elem_data against threaded condense() calls.
+   */
+  Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_STATIC_CONDENSATION_H
@@ -38,6 +38,7 @@
 #include <set>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -279,6 +280,16 @@ public:
    */
   virtual void reinit_constraints ();
 
+  /**
+   * Updates the values of the Dirichlet constraints for the current
+   * \p time, keeping every constraint row as \p reinit_constraints()
+   * last built it.  Much cheaper than \p reinit_constraints() when
+   * only the boundary values are time dependent; see
+   * \p DofMap::update_dirichlet_constraint_values(), which needs
+   * \p DofMap::set_dirichlet_value_updates() to have been enabled.
+   */
+  void update_dirichlet_constraint_values ();
+
   /**
    * Reinitializes the system with a new mesh.
    */
@@ -295,6 +306,22 @@ public:
    */
   virtual void update ();
 
+  /**
+   * Starts the exchange that update() does, without waiting for the
+   * values from neighboring processors to arrive.  Until end_update()
+   * is called, only the locally owned entries of \p
+   * current_local_solution may be read.
+   *
+   * This lets callers overlap the ghost exchange with work which only
+   * needs local values; see \p FEMSystem::overlap_ghost_update.
+   */
+  void begin_update ();
+
+  /**
+   * Finishes an exchange started by begin_update().
+   */
+  void end_update ();
+
   /**
    * Prepares \p matrix and \p _dof_map for matrix assembly.
    * Does not actually assemble anything.  For matrix assembly,
@@ -724,6 +751,28 @@ public:
    */
   DofMap & get_dof_map();
 
+  /**
+   * Makes this system use the DofMap of \p source, which must be an
+   * earlier system in the same EquationSystems, instead of its own.
+   * Dof indices are then stored on the mesh only once, and the
+   * solution vectors, send_list, constraints and sparsity pattern
+   * are all \p source's.  This system must add variables with the
+   * same types and subdomains, in the same order, as \p source
+   * (names may differ), and must be told before it is initialized.
+   *
+   * The shared DofMap is read-only to this system: its dofs are
+   * distributed and its constraints built by \p source alone, so
+   * this system's user_constrain() is never called.  Code looking
+   * up this system's dof indices directly on DofObjects needs
+   * get_dof_map().sys_number() rather than number().
+   */
+  void alias_dof_map (System & source);
+
+  /**
+   * \returns \p true if this system uses another system's DofMap.
+   */
+  bool has_aliased_dof_map () const { return _dof_map_source != nullptr; }
+
   /**
    * \returns A constant reference to this system's parent EquationSystems object.
    */
@@ -813,6 +862,31 @@ public:
    */
   void remove_vector(std::string_view vec_name);
 
+  class TemporaryVector;
+
+  /**
+   * \returns A zeroed vector with this system's current parallel
+   * layout, \p type \p PARALLEL, \p GHOSTED (with the \p DofMap send
+   * list as ghost indices) or \p SERIAL, for short-lived use in place
+   * of e.g. \p solution->zero_clone().
+   *
+   * The vector is checked out of a pool kept by this system, and is
+   * returned to it when the \p TemporaryVector is destroyed, so
+   * repeated temporaries (e.g. in every time step or nonlinear
+   * iteration) don't build new vectors and ghosting structures.  The
+   * pool is emptied whenever the system is reinitialized.
+   *
+   * The \p TemporaryVector must not outlive this system, and the pool
+   * should only be used from the thread that owns the system.
+   */
+  TemporaryVector temporary_vector (const ParallelType type = PARALLEL);
+
+  /**
+   * Frees all vectors in the pool used by \p temporary_vector().
+   * Vectors currently checked out are freed when they are returned.
+   */
+  void clear_temporary_vectors ();
+
   /**
    * Tells the System whether or not to project the solution vector onto new
    * grids when the system is reinitialized.  The solution will be projected
@@ -1365,12 +1439,89 @@ public:
   void write_parallel_data (Xdr & io,
                             const bool write_additional_data) const;
 
+  /**
+   * Writes the solution, and the additional vectors if
+   * \p write_additional_data is true, to the binary file \p name in a
+   * chunked format.  Each processor splits the values of its own
+   * nodes and elements, variable by variable, into chunks of at most
+   * \p chunk_size objects and compresses each chunk independently
+   * (with zlib, when libMesh was built with it).  The chunks are then
+   * written concurrently into the one shared file, behind an index
+   * giving the vector, variable and DofObject id range of each chunk.
+   * With MPI this is done through collective MPI-IO, each processor
+   * writing its chunks directly at their offset in the file, so no
+   * data is funneled through processor 0.
+   *
+   * Values are keyed by DofObject id rather than by dof index or
+   * file position, so the file can be read back with any number of
+   * processors and any partitioning of a mesh with the same
+   * numbering.
+   *
+   * This method must be called on every processor, and \p name must
+   * be on a file system that every processor can write to.
+   */
+  void write_chunked_data (std::string_view name,
+                           const bool write_additional_data,
+                           const unsigned int chunk_size = 16384) const;
+
+  /**
+   * Reads data written by \p write_chunked_data().  Each processor
+   * only decompresses the chunks whose id ranges overlap its local
+   * nodes and elements.  Variables and vectors are matched by name, so
+   * variables or vectors in the file that this System does not have
+   * are skipped without being read.
+   *
+   * This method must be called on every processor.
+   */
+  void read_chunked_data (std::string_view name,
+                          const bool read_additional_data);
+
   /**
    * \returns A string containing information about the
    * system.
    */
   std::string get_info () const;
 
+  /**
+   * \returns Estimates of the memory, in bytes, used on this processor
+   * by the system's DofMap, vectors and matrices.  Matrix storage is
+   * estimated from the DofMap sparsity pattern counts.
+   */
+  std::vector<std::pair<std::string, std::size_t>> local_memory_usage () const;
+
+  /**
+   * Records that the last assembly on this processor took \p time
+   * seconds to assemble \p n_elem elements with \p n_qp quadrature
+   * points in total, for get_diagnostics_info().  assemble() and
+   * FEMSystem::assembly() record this themselves; user assembly code
+   * which knows its quadrature point count may call this to report
+   * it, and assemble() will then keep that record.
+   */
+  void record_assembly (std::size_t n_elem,
+                        std::size_t n_qp,
+                        double time);
+
+  /**
+   * \returns The throughput of the last recorded assembly on this
+   * processor, in elements and quadrature points per second, with
+   * the DofMap::local_diagnostics() appended.
+   */
+  std::vector<std::pair<std::string, double>> local_diagnostics () const;
+
+  /**
+   * \returns A table of the local_diagnostics() with their minimum,
+   * maximum and mean per processor, followed by the nonzeros per row
+   * histogram of the DofMap.  This must be called on all processors
+   * at once.
+   */
+  std::string get_diagnostics_info () const;
+
+  /**
+   * Prints the table from get_diagnostics_info(), by default to
+   * libMesh::out.
+   */
+  void print_diagnostics_info (std::ostream & os=libMesh::out) const;
+
   /**
    * Register a user function to use in initializing the system.
    */
@@ -1782,6 +1933,27 @@ public:
     project_with_constraints = _project_with_constraints;
   }
 
+  /**
+   * Setter and getter functions for project_with_matrix boolean.
+   *
+   * If \p true, then when more than one vector of this system needs
+   * projecting after a mesh change, the projection is computed once
+   * as a sparse matrix (see \p projection_matrix()) and applied to
+   * each vector, instead of being recomputed element by element for
+   * every vector.  This trades the memory of that matrix for much
+   * less work on systems which store many vectors.  It requires
+   * MetaPhysicL, and is ignored for serial vectors.  Off by default.
+   */
+  bool get_project_with_matrix() const
+  {
+    return project_with_matrix;
+  }
+
+  void set_project_with_matrix(bool _project_with_matrix)
+  {
+    project_with_matrix = _project_with_matrix;
+  }
+
   /**
    * \returns A writable reference to a boolean that determines if this system
    * can be written to file or not.  If set to \p true, then
@@ -1935,6 +2107,57 @@ protected:
                        NumericVector<Number> &,
                        int is_adjoint = -1) const;
 
+  /**
+   * Projects each of \p vectors, defined on the old mesh, onto the
+   * new mesh in place.  The work which depends only on the meshes
+   * and dof numberings (the old dofs to localize, and the node to
+   * element map) is done once for all the vectors.
+   *
+   * Constrain \p vectors[i] using the requested adjoint rather than
+   * primal constraints if \p is_adjoint[i] is non-negative.
+   */
+  void project_vectors (const std::vector<NumericVector<Number> *> & vectors,
+                        const std::vector<int> & is_adjoint) const;
+
+#ifdef LIBMESH_ENABLE_AMR
+  /**
+   * \returns The sorted old dof indices needed on this processor to
+   * project a vector onto the new mesh.
+   */
+  std::vector<dof_id_type> projection_send_list () const;
+
+  /**
+   * Projects \p old_v onto \p new_v, given the result of \p
+   * projection_send_list() (which may be empty if \p old_v is
+   * SERIAL) and an optional precomputed node to element map.
+   */
+  void project_vector (const NumericVector<Number> & old_v,
+                       NumericVector<Number> & new_v,
+                       int is_adjoint,
+                       const std::vector<dof_id_type> & old_send_list,
+                       std::unordered_map<dof_id_type, std::vector<dof_id_type>> * nodes_to_elem) const;
+#endif // LIBMESH_ENABLE_AMR
+
+#ifdef LIBMESH_HAVE_METAPHYSICL
+  /**
+   * Projects the vector defined on the old mesh onto the new mesh
+   * by multiplying it by \p proj_mat, as given by \p
+   * projection_matrix().  The vector must not be SERIAL.
+   *
+   * Constrain the new vector using the requested adjoint rather than
+   * primal constraints if is_adjoint is non-negative.
+   */
+  void project_vector (const SparseMatrix<Number> & proj_mat,
+                       NumericVector<Number> &,
+                       int is_adjoint = -1) const;
+
+  /**
+   * \returns A newly built and filled \p projection_matrix(), sized
+   * with preallocation suitable for the current old and new dofs.
+   */
+  std::unique_ptr<SparseMatrix<Number>> build_projection_matrix () const;
+#endif // LIBMESH_HAVE_METAPHYSICL
+
   /*
    * If we have e.g. a element space constrained by spline values, we
    * can directly project only on the constrained basis; to get
@@ -1953,6 +2176,12 @@ private:
   void late_matrix_init(SparseMatrix<Number> & mat,
                         ParallelType type);
 
+  /**
+   * \returns \p true if our matrices can use the current sparsity
+   * pattern of the DofMap we alias, rather than rebuilding it.
+   */
+  bool can_reuse_shared_sparsity () const;
+
   /**
    * Finds the discrete norm for the entries in the vector
    * corresponding to Dofs associated with var.
@@ -2112,6 +2341,11 @@ private:
    */
   std::unique_ptr<DofMap> _dof_map;
 
+  /**
+   * The system whose DofMap we use instead of our own, if any.
+   */
+  System * _dof_map_source;
+
   /**
    * Constant reference to the \p EquationSystems object
    * used for the simulation.
@@ -2251,6 +2485,78 @@ private:
    * Do we want to apply constraints while projecting vectors ?
    */
   bool project_with_constraints;
+
+  /**
+   * Do we want to project multiple vectors with a single projection
+   * matrix?
+   */
+  bool project_with_matrix;
+
+  /**
+   * The number of elements and quadrature points, and the time, of
+   * the last recorded assembly, and whether one was recorded since
+   * assemble() last started.
+   */
+  std::size_t _last_assembly_n_elem;
+  std::size_t _last_assembly_n_qp;
+  double _last_assembly_time;
+  bool _assembly_recorded;
+
+  /**
+   * Takes back a vector checked out by \p temporary_vector(), unless
+   * it was checked out before the pool was last cleared.
+   */
+  void return_temporary_vector (std::unique_ptr<NumericVector<Number>> vec,
+                                ParallelType type,
+                                unsigned int generation);
+
+  /**
+   * The vectors available to \p temporary_vector(), with the type
+   * each was requested as, and the number of
+   * times the pool has been cleared, which invalidates the layout of
+   * any vector checked out before.
+   */
+  std::vector<std::pair<ParallelType, std::unique_ptr<NumericVector<Number>>>> _temporary_vectors;
+  unsigned int _temporary_vector_generation;
+};
+
+
+
+/**
+ * A vector checked out of a \p System pool by \p
+ * System::temporary_vector(), which goes back to the pool when this
+ * object is destroyed.
+ */
+class System::TemporaryVector
+{
+public:
+  TemporaryVector (TemporaryVector &&) = default;
+  TemporaryVector & operator= (TemporaryVector &&);
+  TemporaryVector (const TemporaryVector &) = delete;
+  TemporaryVector & operator= (const TemporaryVector &) = delete;
+  ~TemporaryVector ();
+
+  NumericVector<Number> & operator* () const { return *_vec; }
+  NumericVector<Number> * operator-> () const { return _vec.get(); }
+  NumericVector<Number> * get () const { return _vec.get(); }
+
+private:
+  friend class System;
+
+  TemporaryVector (System & sys,
+                   std::unique_ptr<NumericVector<Number>> vec,
+                   ParallelType type,
+                   unsigned int generation);
+
+  /**
+   * Returns the vector to the pool now.
+   */
+  void release ();
+
+  System * _system;
+  std::unique_ptr<NumericVector<Number>> _vec;
+  ParallelType _type;
+  unsigned int _generation;
 };
 
 
@@ -2292,7 +2598,7 @@ MeshBase & System::get_mesh()
 inline
 const DofMap & System::get_dof_map() const
 {
-  return *_dof_map;
+  return _dof_map_source ? *_dof_map_source->_dof_map : *_dof_map;
 }
 
 
@@ -2300,7 +2606,7 @@ const DofMap & System::get_dof_map() const
 inline
 DofMap & System::get_dof_map()
 {
-  return *_dof_map;
+  return _dof_map_source ? *_dof_map_source->_dof_map : *_dof_map;
 }
 
 
@@ -0,0 +1,162 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+
+#ifndef LIBMESH_DISTRIBUTED_POINT_LOCATOR_H
+#define LIBMESH_DISTRIBUTED_POINT_LOCATOR_H
+
+// Local Includes
+#include "libmesh/bounding_box.h"
+#include "libmesh/dof_object.h"
+#include "libmesh/id_types.h"
+#include "libmesh/parallel_object.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+class PointLocatorBase;
+
+/**
+ * A point locator for meshes whose elements are spread over several
+ * processors, such as a DistributedMesh.  The ordinary point locators
+ * can only find points in elements present on the processor doing
+ * the search.  This class instead finds every queried point on the
+ * processor that owns its element, wherever the point was queried.
+ *
+ * init() gathers the bounding box of every processor's local
+ * elements.  locate_points() then sends each query point only to the
+ * processors whose boxes contain it, in a single sparse exchange.
+ * Those processors search their local elements and reply with the
+ * element id and the point's reference coordinates in it.
+ *
+ * \brief Locates points in the elements of other processors.
+ */
+class DistributedPointLocator : public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.  This does not do any communication; call init()
+   * on every processor before locating points.
+   */
+  DistributedPointLocator (const MeshBase & mesh);
+
+  /**
+   * Destructor.
+   */
+  ~DistributedPointLocator ();
+
+  /**
+   * Where a point was found.  elem_id is DofObject::invalid_id, and
+   * processor_id is DofObject::invalid_processor_id, if no processor
+   * found an element containing the point.
+   */
+  struct Location
+  {
+    dof_id_type elem_id = DofObject::invalid_id;
+    processor_id_type processor_id = DofObject::invalid_processor_id;
+    Point reference_point;
+
+    bool found () const { return elem_id != DofObject::invalid_id; }
+  };
+
+  /**
+   * Builds the local search tree and gathers the bounding box of
+   * every processor's local elements.  Must be called on all
+   * processors at once, and again after the mesh is changed or
+   * repartitioned.
+   */
+  void init ();
+
+  /**
+   * Frees the local search tree and the bounding boxes.
+   */
+  void clear ();
+
+  /**
+   * \returns \p true iff init() has been called since construction
+   * or the last clear().
+   */
+  bool initialized () const { return _local_locator != nullptr; }
+
+  /**
+   * Locates each of \p points, which may differ from processor to
+   * processor, and stores its location in \p locations.  A point in
+   * several elements, on the boundary between processors, is
+   * assigned to the lowest ranked processor which finds it.
+   *
+   * Optionally restricts the search to \p allowed_subdomains, which
+   * must then be the same on every processor.
+   *
+   * Must be called on all processors at once.
+   */
+  void locate_points (const std::vector<Point> & points,
+                      std::vector<Location> & locations,
+                      const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const;
+
+  /**
+   * Sets the tolerance used when checking whether a point is in an
+   * element.  See PointLocatorBase::set_contains_point_tol().
+   */
+  void set_contains_point_tol (Real contains_point_tol);
+
+  /**
+   * \returns The bounding box of each processor's local elements, as
+   * gathered by init().
+   */
+  const std::vector<BoundingBox> & processor_bounding_boxes () const
+  { return _processor_boxes; }
+
+private:
+
+  /**
+   * The mesh we are locating points in.
+   */
+  const MeshBase & _mesh;
+
+  /**
+   * Finds points in our local elements.
+   */
+  std::unique_ptr<PointLocatorBase> _local_locator;
+
+  /**
+   * The bounding box of each processor's local elements, slightly
+   * enlarged so that points on their surfaces are sent there too.
+   */
+  std::vector<BoundingBox> _processor_boxes;
+
+  /**
+   * Whether to use a custom tolerance, and the tolerance to use.
+   */
+  bool _use_contains_point_tol;
+  Real _contains_point_tol;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DISTRIBUTED_POINT_LOCATOR_H
@@ -25,8 +25,10 @@
 // Local Includes
 #include "libmesh/libmesh_common.h"
 #include "libmesh/point.h"
+#include "libmesh/threads.h"
 
 // C++ Includes
+#include <array>
 #include <unordered_map>
 #include <vector>
 
@@ -45,6 +47,10 @@ class Node;
  * For efficiency we will use a hashed multimap if it is
  * available, otherwise a regular multimap.
  *
+ * Once \p init() has set the bounding box, the map is split into
+ * shards which are each locked separately, so \p insert() and \p
+ * find() may be called concurrently from multiple threads.
+ *
  * \author Roy Stogner
  * \date 2008
  * \brief std::map-like data structure using hashed Points for keys.
@@ -56,11 +62,24 @@ class LocationMap
 public:
   void init(MeshBase &);
 
-  void clear() { _map.clear(); }
+  void clear();
 
   void insert(T &);
 
-  bool empty() const { return _map.empty(); }
+  /**
+   * Inserts all of \p objects, locking each shard of the map only
+   * once.
+   */
+  void insert(const std::vector<T *> & objects);
+
+  /**
+   * Moves every entry of \p other, which must have been initialized
+   * with the same bounding box, into this map, leaving \p other
+   * empty.
+   */
+  void merge(LocationMap & other);
+
+  bool empty() const;
 
   T * find(const Point &,
            const Real tol = TOLERANCE);
@@ -73,7 +92,31 @@ protected:
   void fill(MeshBase &);
 
 private:
-  map_type          _map;
+  /**
+   * The number of independently locked pieces of the map.
+   */
+  static constexpr unsigned int n_shards = 64;
+
+  struct Shard
+  {
+    map_type map;
+    mutable Threads::spin_mutex mutex;
+  };
+
+  /**
+   * \returns The shard holding \p pointkey.
+   */
+  static unsigned int shard_of(unsigned int pointkey);
+
+  /**
+   * \returns An object stored under \p pointkey within \p tol of \p
+   * p, or \p nullptr.
+   */
+  T * find_in_bin(unsigned int pointkey,
+                  const Point & p,
+                  const Real tol);
+
+  std::array<Shard, n_shards> _shards;
   std::vector<Real> _lower_bound;
   std::vector<Real> _upper_bound;
 };
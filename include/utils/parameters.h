@@ -114,6 +114,24 @@ public:
   template <typename T>
   const T & get (std::string_view) const;
 
+  template <typename T>
+  class Handle;
+
+  /**
+   * \returns A handle to the specified parameter value, which
+   * requires that the parameter exists just like \p get().
+   * Dereferencing the handle reads the current value without any
+   * lookup of the name, so it can be obtained once outside of an
+   * element or quadrature point loop and used inside.
+   *
+   * The handle stays valid until the parameter is removed or replaced
+   * by a parameter of another type, or \p this is cleared, assigned
+   * to or added to.  The reference returned by \p set() remains valid
+   * for just as long, and can be used the same way for writing.
+   */
+  template <typename T>
+  Handle<T> get_handle (std::string_view) const;
+
   /**
    * Inserts a new Parameter into the object but does not return
    * a writable reference.  The value of the newly inserted
@@ -241,6 +259,38 @@ public:
     T _value;
   };
 
+  /**
+   * A read-only reference to the value of a parameter of type \p T,
+   * as returned by \p get_handle().
+   */
+  template <typename T>
+  class Handle
+  {
+  public:
+    /**
+     * Constructs a handle which refers to no parameter.
+     */
+    Handle () = default;
+
+    /**
+     * \returns The current value of the parameter.
+     */
+    const T & operator* () const { libmesh_assert(_value); return *_value; }
+    const T * operator-> () const { libmesh_assert(_value); return _value; }
+
+    /**
+     * \returns \p true if this handle refers to a parameter.
+     */
+    bool valid () const { return _value != nullptr; }
+
+  private:
+    friend class Parameters;
+
+    explicit Handle (const T & value) : _value(&value) {}
+
+    const T * _value = nullptr;
+  };
+
   /**
    * The type of the map that we store internally.
    */
@@ -425,7 +475,18 @@ template <typename T>
 inline
 const T & Parameters::get (std::string_view name) const
 {
-  if (!this->have_parameter<T>(name))
+  // Look the name up only once
+  Parameters::const_iterator it = _values.find(name);
+
+#ifdef LIBMESH_HAVE_RTTI
+  const Parameter<T> * ptr = (it == _values.end()) ? nullptr :
+    dynamic_cast<const Parameter<T> *>(it->second.get());
+#else
+  const Parameter<T> * ptr = (it == _values.end()) ? nullptr :
+    cast_ptr<const Parameter<T> *>(it->second.get());
+#endif
+
+  if (!ptr)
     {
       std::ostringstream oss;
 
@@ -441,18 +502,17 @@ const T & Parameters::get (std::string_view name) const
       libmesh_error_msg(oss.str());
     }
 
-  Parameters::const_iterator it = _values.find(name);
-
-  libmesh_assert(it != _values.end());
-  libmesh_assert(it->second);
-
-  // Get pointer to derived type
-  auto ptr = cast_ptr<Parameter<T> *>(it->second.get());
-
   // Return const reference
   return ptr->get();
 }
 
+template <typename T>
+inline
+Parameters::Handle<T> Parameters::get_handle (std::string_view name) const
+{
+  return Handle<T>(this->get<T>(name));
+}
+
 template <typename T>
 inline
 void Parameters::insert (const std::string & name)
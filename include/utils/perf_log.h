@@ -23,14 +23,17 @@
 
 // Local includes
 #include "libmesh/libmesh_common.h"
+#include "libmesh/perfmon.h"
 
 // C++ includes
+#include <algorithm>
 #include <cstddef>
 #include <map>
 #include <stack>
 #include <string>
 #include <vector>
 #include <deque>
+#include <functional>
 #include <memory>
 #ifdef LIBMESH_HAVE_SYS_TIME_H
 #include <sys/time.h> // gettimeofday() on Unix
@@ -42,6 +45,140 @@
 namespace libMesh
 {
 
+// Forward declarations
+namespace Parallel {
+  class Communicator;
+}
+
+/**
+ * The \p CommPerfData class contains the MPI traffic recorded for
+ * an event, as seen from this processor.
+ *
+ * \brief Data object managed by PerfLog
+ */
+class CommPerfData
+{
+public:
+
+  CommPerfData () :
+    bytes_sent(0),
+    bytes_received(0),
+    messages_sent(0),
+    messages_received(0),
+    collectives(0),
+    wait_time(0.)
+  {}
+
+  /**
+   * Bytes sent and received, by point-to-point messages and by this
+   * processor's part in collective operations.
+   */
+  std::uint64_t bytes_sent;
+  std::uint64_t bytes_received;
+
+  /**
+   * The number of point-to-point messages sent and received.
+   */
+  std::uint64_t messages_sent;
+  std::uint64_t messages_received;
+
+  /**
+   * The number of collective operations.
+   */
+  std::uint64_t collectives;
+
+  /**
+   * Wall time spent in MPI calls which can block: receives, waits,
+   * probes, blocking sends, and collectives.
+   */
+  double wait_time;
+
+  /**
+   * \returns \p true iff nothing was recorded.
+   */
+  bool empty () const
+  {
+    return !bytes_sent && !bytes_received && !messages_sent &&
+      !messages_received && !collectives;
+  }
+
+  /**
+   * Sums traffic from \p other
+   */
+  CommPerfData & operator += (const CommPerfData & other)
+  {
+    bytes_sent += other.bytes_sent;
+    bytes_received += other.bytes_received;
+    messages_sent += other.messages_sent;
+    messages_received += other.messages_received;
+    collectives += other.collectives;
+    wait_time += other.wait_time;
+
+    return *this;
+  }
+};
+
+
+
+/**
+ * The \p MemoryPerfData class contains the memory use recorded for
+ * an event on this processor.
+ *
+ * \brief Data object managed by PerfLog
+ */
+class MemoryPerfData
+{
+public:
+
+  MemoryPerfData () :
+    rss_growth(0),
+    heap_growth(0),
+    peak_rss(0),
+    peak_heap(0)
+  {}
+
+  /**
+   * How much the peak resident set size of the process grew while
+   * this event was active, including sub-events, summed over every
+   * call.  Only events which set a new high-water mark grow it, so
+   * this points straight at the events causing memory spikes.
+   */
+  std::size_t rss_growth;
+
+  /**
+   * The net change in heap memory in use while this event was
+   * active, including sub-events, summed over every call.
+   */
+  std::int64_t heap_growth;
+
+  /**
+   * The largest peak resident set size, and the most heap memory in
+   * use, seen when this event started or stopped.
+   */
+  std::size_t peak_rss;
+  std::size_t peak_heap;
+
+  /**
+   * \returns \p true iff nothing was recorded.
+   */
+  bool empty () const { return !peak_rss && !peak_heap; }
+
+  /**
+   * Sums growth, and takes the maximum peaks, from \p other
+   */
+  MemoryPerfData & operator += (const MemoryPerfData & other)
+  {
+    rss_growth += other.rss_growth;
+    heap_growth += other.heap_growth;
+    peak_rss = std::max(peak_rss, other.peak_rss);
+    peak_heap = std::max(peak_heap, other.peak_heap);
+
+    return *this;
+  }
+};
+
+
+
 /**
  * The \p PerfData class simply contains the performance
  * data that is recorded for individual events.
@@ -64,6 +201,9 @@ public:
     tstart_incl_sub(),
     count(0),
     open(false),
+    counts(),
+    comm_data(),
+    mem_data(),
     called_recursively(0)
   {}
 
@@ -103,6 +243,26 @@ public:
    */
   bool open;
 
+  /**
+   * Hardware counter totals for this event, excluding sub-events.
+   * These stay zero unless the PerfLog is counting them; see
+   * PerfLog::enable_hardware_counters().
+   */
+  PerfMon::Counts counts;
+
+  /**
+   * MPI traffic during this event, excluding sub-events.  This stays
+   * empty unless the PerfLog is logging communication; see
+   * PerfLog::enable_communication_logging().
+   */
+  CommPerfData comm_data;
+
+  /**
+   * Memory use during this event.  This stays empty unless the
+   * PerfLog is logging memory; see PerfLog::enable_memory_logging().
+   */
+  MemoryPerfData mem_data;
+
   void   start ();
   void   restart ();
   double pause ();
@@ -118,6 +278,10 @@ public:
     tot_time += other.tot_time;
     tot_time_incl_sub += other.tot_time_incl_sub;
     count += other.count;
+    for (std::size_t c = 0; c != counts.size(); ++c)
+      counts[c] += other.counts[c];
+    comm_data += other.comm_data;
+    mem_data += other.mem_data;
 
     return *this;
   }
@@ -130,6 +294,51 @@ protected:
 
 
 
+/**
+ * The \p ThreadedPerfData class contains the performance data
+ * recorded for an event logged inside threaded loops, summed over
+ * every thread and every loop.
+ *
+ * \brief Data object managed by PerfLog
+ */
+class ThreadedPerfData
+{
+public:
+
+  ThreadedPerfData () :
+    tot_time(0.),
+    tot_time_incl_sub(0.),
+    max_thread_time_incl_sub(0.),
+    count(0)
+  {}
+
+  /**
+   * Total time spent in this event on all threads.
+   */
+  double tot_time;
+
+  /**
+   * Total time spent in this event on all threads, including
+   * sub-events.
+   */
+  double tot_time_incl_sub;
+
+  /**
+   * The sum, over every threaded loop, of the largest time any one
+   * thread spent in this event (including sub-events) during that
+   * loop.  Compared to the mean time per thread this measures load
+   * imbalance.
+   */
+  double max_thread_time_incl_sub;
+
+  /**
+   * The number of times this event has been executed on all threads.
+   */
+  unsigned int count;
+};
+
+
+
 
 /**
  * The \p PerfLog class allows monitoring of specific events.
@@ -201,6 +410,149 @@ public:
    */
   bool summarized_logs_enabled() { return summarize_logs; }
 
+  /**
+   * Tells the PerfLog to also record the call tree of events, i.e.
+   * timings for every distinct stack of nested events rather than
+   * only for each (header, label) pair.  This costs an extra map
+   * lookup per push, so it is off by default.  It may only be
+   * enabled while no events are being monitored.
+   */
+  void enable_call_tree();
+
+  /**
+   * Tells the PerfLog to stop recording the call tree of events.
+   * Any call tree data already recorded is discarded.
+   */
+  void disable_call_tree();
+
+  /**
+   * \returns \p true iff the call tree of events is being recorded
+   */
+  bool call_tree_enabled() const { return track_call_tree; }
+
+  /**
+   * Tells the PerfLog to record events pushed from inside threaded
+   * loops, which are otherwise ignored.  Each thread then logs to a
+   * stack of its own, and the per-thread logs are merged at the end
+   * of every loop into a separate summary of threaded events which
+   * includes the load imbalance between threads.
+   */
+  void enable_thread_logging() { log_threads = true; }
+
+  /**
+   * Tells the PerfLog to ignore events pushed from inside threaded
+   * loops (this is the default behavior).
+   */
+  void disable_thread_logging() { log_threads = false; }
+
+  /**
+   * \returns \p true iff events inside threaded loops are logged.
+   */
+  bool thread_logging_enabled() const { return log_threads; }
+
+  /**
+   * Tells the PerfLog to also read the hardware performance counters
+   * of the calling thread (see \p PerfMon) whenever an event is
+   * pushed or popped, attribute the counts to events the same way as
+   * their exclusive times, and report them in a separate table.
+   * This costs a system call per push and pop, so it is off by
+   * default.  Work done by other threads, including events inside
+   * threaded loops, is not counted.  It may only be enabled while no
+   * events are being monitored.
+   *
+   * If no counters can be read on this system a warning is printed
+   * and counting stays disabled.
+   */
+  void enable_hardware_counters();
+
+  /**
+   * Tells the PerfLog to stop reading hardware counters.  Counts
+   * already recorded are kept.
+   */
+  void disable_hardware_counters();
+
+  /**
+   * \returns \p true iff hardware counters are being read.
+   */
+  bool hardware_counters_enabled() const { return perf_mon != nullptr; }
+
+  /**
+   * Tells the PerfLog to record the MPI traffic of this processor
+   * (bytes, messages, collectives, and time waiting) and attribute
+   * it to the innermost active event.  This requires a library
+   * configured with --enable-perflog-mpi, which intercepts MPI calls
+   * through the MPI profiling interface; otherwise a warning is
+   * printed and nothing is recorded.  Traffic inside threaded loops
+   * is not recorded.
+   */
+  void enable_communication_logging();
+
+  /**
+   * Tells the PerfLog to stop recording MPI traffic.  Traffic already
+   * recorded is kept.
+   */
+  void disable_communication_logging() { log_comm = false; }
+
+  /**
+   * \returns \p true iff MPI traffic is being recorded.
+   */
+  bool communication_logging_enabled() const { return log_comm; }
+
+  /**
+   * Records MPI traffic for the innermost active event, or as
+   * traffic outside any event if there is none.  This is called by
+   * the MPI profiling wrappers, and should usually not need to be
+   * called directly.
+   */
+  void log_communication(const CommPerfData & data) noexcept;
+
+  /**
+   * Tells the PerfLog to also record the peak resident set size of
+   * the process (from getrusage()) and the heap memory in use
+   * whenever an event is pushed or popped, and report per-event
+   * growth and peaks.  This costs two system calls per push and pop,
+   * and the heap query can be slow with many allocator arenas, so it
+   * is off by default.  It may only be enabled while no events are
+   * being monitored.
+   */
+  void enable_memory_logging();
+
+  /**
+   * Tells the PerfLog to stop recording memory use.  Memory use
+   * already recorded is kept.
+   */
+  void disable_memory_logging();
+
+  /**
+   * \returns \p true iff memory use is being recorded.
+   */
+  bool memory_logging_enabled() const { return log_memory; }
+
+  /**
+   * Replaces the function used to query the heap memory in use, in
+   * bytes.  The default queries mallinfo2() with glibc 2.33 or newer,
+   * and otherwise reports zero; applications using another allocator
+   * can supply its statistics instead.
+   */
+  void set_heap_usage_function(std::function<std::size_t()> heap_usage_function);
+
+  /**
+   * Tells the PerfLog that a threaded loop is starting.  Until
+   * end_threaded_region() is called, events are logged per thread if
+   * thread logging is enabled, and ignored otherwise.
+   *
+   * This is called by Threads::DisablePerfLogInScope and should
+   * usually not need to be called directly.
+   */
+  void begin_threaded_region();
+
+  /**
+   * Tells the PerfLog that a threaded loop has finished, and merges
+   * the per-thread logs from that loop.  Must be called after every
+   * thread has finished its work.
+   */
+  void end_threaded_region();
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    *
@@ -305,11 +657,56 @@ public:
    */
   std::string get_perf_info() const;
 
+  /**
+   * \returns A string containing ONLY the log information for events
+   * inside threaded loops, or an empty string if there are none.
+   */
+  std::string get_threaded_perf_info() const;
+
+  /**
+   * \returns A string containing ONLY the hardware counter
+   * information, or an empty string if none were counted.
+   */
+  std::string get_counter_perf_info() const;
+
+  /**
+   * \returns A string containing ONLY the MPI traffic information, or
+   * an empty string if none was recorded.
+   */
+  std::string get_communication_perf_info() const;
+
+  /**
+   * \returns A string containing ONLY the memory use information, or
+   * an empty string if none was recorded.
+   */
+  std::string get_memory_perf_info() const;
+
   /**
    * Print the log.
    */
   void print_log() const;
 
+  /**
+   * \returns A string containing the log as a JSON object, with
+   * events grouped by header, inclusive and exclusive times, and
+   * the min, max, mean, and per-rank values of every quantity across
+   * the processors of \p comm.  If the call tree is enabled, it is
+   * included as nested objects as well, and so are events logged
+   * inside threaded loops if thread logging is enabled.
+   *
+   * This method is collective on \p comm.  The returned string is
+   * only non-empty on processor 0.  Ranks which never logged an
+   * event contribute zeros to its statistics.
+   */
+  std::string get_json_log(const Parallel::Communicator & comm) const;
+
+  /**
+   * Writes the result of get_json_log() to the file \p filename on
+   * processor 0.  This method is collective on \p comm.
+   */
+  void write_json_log(const std::string & filename,
+                      const Parallel::Communicator & comm) const;
+
   /**
    * \returns The total time spent on this event.
    */
@@ -332,6 +729,13 @@ public:
                              const char *>,
                    PerfData> log_type;
 
+  /**
+   * Typdef for the summary of events inside threaded loops.
+   */
+  typedef std::map<std::pair<const char *,
+                             const char *>,
+                   ThreadedPerfData> threaded_log_type;
+
 private:
 
 
@@ -374,6 +778,158 @@ private:
    */
   std::stack<PerfData*> log_stack;
 
+  /**
+   * Flag to optionally record the call tree of events.
+   */
+  bool track_call_tree;
+
+  /**
+   * Flag to optionally log events inside threaded loops.
+   */
+  bool log_threads;
+
+  /**
+   * Flag indicating that we are inside a threaded loop and logging
+   * its events per thread.
+   */
+  bool in_threaded_region;
+
+  /**
+   * The time the current threaded loop started.
+   */
+  struct timeval threaded_region_tstart;
+
+  /**
+   * The number of threaded loops with logged events, the total wall
+   * time they took, and the largest number of threads seen in one.
+   */
+  unsigned int n_threaded_regions;
+  double threaded_region_time;
+  unsigned int n_logged_threads;
+
+  /**
+   * The summary of events inside threaded loops.
+   */
+  threaded_log_type threaded_log;
+
+  /**
+   * The per-thread logs for the current threaded loop.  Defined in
+   * perf_log.C to keep thread library headers out of this one.
+   */
+  struct ThreadLogs;
+  std::unique_ptr<ThreadLogs> thread_logs;
+
+  /**
+   * Push and pop an event on the calling thread's log.
+   */
+  void thread_push(const char * label,
+                   const char * header);
+  void thread_pop() noexcept;
+
+  /**
+   * The hardware counters, if we are reading them, and their values
+   * when they were last attributed to an event.
+   */
+  std::unique_ptr<PerfMon> perf_mon;
+  PerfMon::Counts last_counts;
+
+  /**
+   * Adds the hardware counts since the last call to the event on top
+   * of \p log_stack, if any.
+   */
+  void count_hardware_events() noexcept;
+
+  /**
+   * Flag to optionally record MPI traffic.
+   */
+  bool log_comm;
+
+  /**
+   * MPI traffic recorded while no event was active.
+   */
+  CommPerfData untimed_comm_data;
+
+  /**
+   * Flag to optionally record memory use.
+   */
+  bool log_memory;
+
+  /**
+   * Returns the heap memory in use, in bytes.
+   */
+  std::function<std::size_t()> heap_usage;
+
+  /**
+   * The memory use when each event in \p log_stack was pushed.
+   */
+  struct MemorySnapshot
+  {
+    std::size_t peak_rss;
+    std::size_t heap;
+  };
+  std::vector<MemorySnapshot> memory_stack;
+
+  /**
+   * \returns The current memory use.
+   */
+  MemorySnapshot memory_snapshot() const noexcept;
+
+  /**
+   * Records the memory use at a push, and a pop of the event
+   * \p perf_data, respectively.
+   */
+  void memory_push();
+  void memory_pop(PerfData & perf_data) noexcept;
+
+  /**
+   * A node in the call tree: one event, reached through one
+   * particular stack of enclosing events.
+   */
+  struct CallTreeNode
+  {
+    std::size_t parent;
+    const char * header;
+    const char * label;
+    unsigned int count;
+    double tot_time_incl_sub;
+  };
+
+  /**
+   * The call tree.  Node 0 is a root with no event of its own, and
+   * every other node comes after its parent.
+   */
+  std::vector<CallTreeNode> call_tree;
+
+  /**
+   * Maps (parent node, header, label) to the index of the child
+   * node in \p call_tree.
+   */
+  std::map<std::pair<std::size_t, std::pair<const char *, const char *>>,
+           std::size_t> call_tree_children;
+
+  /**
+   * The call tree nodes of the events in \p log_stack.
+   */
+  std::vector<std::size_t> call_tree_stack;
+
+  /**
+   * Records a push of the event (\p header, \p label) in the call
+   * tree.
+   */
+  void call_tree_push(const char * label,
+                      const char * header);
+
+  /**
+   * Records a pop of the innermost event in the call tree, which
+   * ran for \p elapsed_incl_sub seconds including sub-events.
+   */
+  void call_tree_pop(double elapsed_incl_sub);
+
+  /**
+   * Resets the call tree to just its root.
+   */
+  void clear_call_tree();
+
   /**
    * Flag indicating if print_log() has been called.
    * This is used to print a header with machine-specific
@@ -500,12 +1056,23 @@ void PerfLog::fast_push (const char * label,
       // repeated map lookups
       PerfData * perf_data = &(log[std::make_pair(header,label)]);
 
+      if (perf_mon)
+        this->count_hardware_events();
+
       if (!log_stack.empty())
         total_time += log_stack.top()->pause_for(*perf_data);
       else
         perf_data->start();
       log_stack.push(perf_data);
+
+      if (track_call_tree)
+        this->call_tree_push(label, header);
+
+      if (log_memory)
+        this->memory_push();
     }
+  else if (this->in_threaded_region)
+    this->thread_push(label, header);
 }
 
 
@@ -571,18 +1138,40 @@ void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
 
               return;
             }
+
+          // Abandon the call tree entries of the intermediate items
+          // too.
+          if (track_call_tree)
+            call_tree_stack.resize(log_stack.size());
+          if (log_memory && memory_stack.size() > log_stack.size())
+            memory_stack.resize(log_stack.size());
         }
 #endif
 
       // In optimized mode, we just pop from the top of the stack and
       // resume timing the next entry.
-      total_time += log_stack.top()->stopit();
+      if (perf_mon)
+        this->count_hardware_events();
+
+      PerfData * perf_data_top = log_stack.top();
+      const double tot_time_incl_sub_before = perf_data_top->tot_time_incl_sub;
+
+      total_time += perf_data_top->stopit();
+
+      if (track_call_tree)
+        this->call_tree_pop(perf_data_top->tot_time_incl_sub -
+                            tot_time_incl_sub_before);
+
+      if (log_memory)
+        this->memory_pop(*perf_data_top);
 
       log_stack.pop();
 
       if (!log_stack.empty())
         log_stack.top()->restart();
     }
+  else if (this->in_threaded_region)
+    this->thread_pop();
 }
 
 
@@ -24,14 +24,10 @@
 // Local includes
 #include "libmesh/libmesh_common.h"
 
-#ifdef HAVE_PAPI_H
-namespace Papi {
-#  include <papi.h>
-}
-#endif
-
 // C++ includes
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #ifdef LIBMESH_HAVE_SYS_TIME_H
 #include <sys/time.h> // gettimeofday() on Unix
@@ -46,26 +42,99 @@ namespace libMesh
 
 
 /**
- * PAPI stands for Performance Application Programming Interface.
- * This class was supposed to provide an interface to the hardware
- * timers that PAPI exposes, but it never really got developed.
+ * The \p PerfMon class reads the hardware performance counters of
+ * the calling thread: cycles, instructions, and last level cache
+ * references and misses.  On Linux these come from the kernel's
+ * perf_event interface; elsewhere, or when the kernel refuses access
+ * (see /proc/sys/kernel/perf_event_paranoid), \p counting() is false
+ * and every count reads as zero.
+ *
+ * Constructed with a nonzero verbosity, a \p PerfMon prints the wall
+ * time and counts since construction (or the last \p reset()) when
+ * it is destroyed.  The \p PerfLog uses a silent one to attribute
+ * counts to its events; see \p PerfLog::enable_hardware_counters().
  *
  * \author Benjamin S. Kirk
  * \date 2002
- * \brief A class for interfacing with hardware timers.
+ * \brief A class for reading hardware performance counters.
  */
 class PerfMon
 {
 public:
+  /**
+   * The hardware events we count.
+   */
+  enum Counter : unsigned int { CYCLES = 0,
+                                INSTRUCTIONS,
+                                LLC_REFERENCES,
+                                LLC_MISSES,
+                                N_COUNTERS };
+
+  /**
+   * Cumulative values of every counter.
+   */
+  typedef std::array<std::uint64_t, N_COUNTERS> Counts;
+
+  /**
+   * The number of bytes each last level cache miss is assumed to
+   * move from memory, for estimating memory bandwidth.
+   */
+  static constexpr unsigned int cache_line_bytes = 64;
+
   PerfMon  (std::string id,
             const unsigned int v=1,
             const unsigned int pid=0);
 
+  /**
+   * Prints, if verbose, and releases the counters.
+   */
   ~PerfMon ();
+
+  /**
+   * This class owns file descriptors, so it can't be copied.
+   */
+  PerfMon (const PerfMon &) = delete;
+  PerfMon & operator= (const PerfMon &) = delete;
+
+  /**
+   * Restarts the wall clock and the counters at zero.
+   */
   void reset ();
+
+  /**
+   * Prints the wall time and counter values since the last \p
+   * reset(), labeled with \p msg or (by default) the id this object
+   * was constructed with, if this object is verbose and on processor
+   * 0.
+   *
+   * \returns The wall time since the last \p reset().
+   */
   double print (std::string msg="NULL",
                 std::ostream & my_out = libMesh::out);
 
+  /**
+   * \returns \p true iff any hardware counter could be opened.
+   */
+  bool counting () const { return _counting; }
+
+  /**
+   * \returns \p true iff the counter \p c could be opened.
+   * Unavailable counters always read as zero.
+   */
+  bool counting (Counter c) const { return _fds[c] >= 0; }
+
+  /**
+   * Fills \p counts with the value of every counter since the last
+   * \p reset(), scaled up to compensate for any time the kernel had
+   * to multiplex the counters off the hardware.
+   */
+  void read (Counts & counts) const;
+
+  /**
+   * \returns A short human-readable name for the counter \p c.
+   */
+  static const char * counter_name (Counter c);
+
 private:
 
   const std::string id_string;
@@ -76,98 +145,27 @@ private:
   const unsigned int verbose;
   const unsigned int proc_id;
 
-#ifdef HAVE_PAPI_H
-  float rtime, ptime, mflops;
-  long long int flpins;
-#endif
+  /**
+   * The perf_event file descriptor of every counter, or -1 if the
+   * counter couldn't be opened.  The first open one leads the group,
+   * so they can all be read at once.
+   */
+  std::array<int, N_COUNTERS> _fds;
+  int _leader;
+  bool _counting;
+
+  /**
+   * The counter values at the last \p reset().
+   */
+  Counts _start_counts;
+
+  /**
+   * Fills \p counts with the value of every counter since it was
+   * opened.
+   */
+  void read_since_open (Counts & counts) const;
 };
 
-
-
-inline
-void
-PerfMon::reset ()
-{
-  gettimeofday (&the_time_start, nullptr);
-
-#ifdef HAVE_PAPI_H
-  Papi::PAPI_flops (&rtime, & ptime, &flpins, &mflops);
-#endif
-}
-
-
-
-inline
-double
-PerfMon::print (std::string msg, std::ostream & my_out)
-{
-  gettimeofday (&the_time_stop, nullptr);
-
-#ifdef HAVE_PAPI_H
-  Papi::PAPI_flops (&rtime, & ptime, &flpins, &mflops);
-#endif
-
-  const double elapsed_time = ((double) (the_time_stop.tv_sec - the_time_start.tv_sec)) +
-    ((double) (the_time_stop.tv_usec - the_time_start.tv_usec))/1000000.;
-
-  if (verbose)
-    {
-
-      if (proc_id == 0)
-        {
-          if (msg == "NULL")
-            my_out << " " << id_string
-                   << ": elapsed time: "
-                   << elapsed_time << " (sec)"
-                   << std::endl;
-          else
-            my_out << " " << msg
-                   << ": elapsed time: "
-                   << elapsed_time << " (sec)"
-                   << std::endl;
-
-#ifdef HAVE_PAPI_H
-          if (msg == "NULL")
-            my_out << " " << id_string
-                   << ": mflops: "
-                   << mflops
-                   << std::endl;
-          else
-            my_out << " " << msg
-                   << ": mflops: "
-                   << mflops
-                   << std::endl;
-#endif
-
-        }
-    }
-
-  return elapsed_time;
-}
-
-
-inline
-PerfMon::PerfMon (std::string id,
-                  const unsigned int v,
-                  const unsigned int pid) :
-  id_string(id),
-  verbose(v),
-  proc_id(pid)
-{
-  reset ();
-}
-
-
-
-inline
-PerfMon::~PerfMon ()
-{
-  print ();
-}
-
-
-
-
 } // namespace libMesh
 
 
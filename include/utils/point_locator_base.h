@@ -105,6 +105,26 @@ public:
                            std::set<const Elem *> & candidate_elements,
                            const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const = 0;
 
+  /**
+   * Locates the element containing each of \p points, storing them
+   * in \p elems in the same order, with nullptr for any point that
+   * no element contains (in out-of-mesh mode).  Optionally allows
+   * the user to restrict the subdomains searched.
+   *
+   * The points are visited in spatial order, and each search first
+   * checks the element found for the previous point, so batches of
+   * nearby points avoid most of the tree or kd-tree traversals that
+   * separate operator() calls would do.  Locators which can build
+   * servants (see build_servant()) also split the batch over
+   * threads.
+   *
+   * A point on the boundary between elements may be assigned to a
+   * different one of those elements than operator() would return.
+   */
+  virtual void locate_points (const std::vector<Point> & points,
+                              std::vector<const Elem *> & elems,
+                              const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const;
+
   /**
    * \returns A pointer to a Node with global coordinates \p p or \p
    * nullptr if no such Node can be found.
@@ -201,6 +221,24 @@ public:
   bool _verbose;
 
 protected:
+  /**
+   * \returns A new locator of the same type, using this one as its
+   * master and with the same tolerances and out-of-mesh mode, or
+   * nullptr if this type of locator doesn't support that.
+   *
+   * Locators keep search state between calls to operator(), so
+   * locate_points() gives each thread a servant of its own.
+   */
+  virtual std::unique_ptr<PointLocatorBase> build_servant () const;
+
+  /**
+   * \returns The element containing \p p, checking \p hint (which
+   * may be nullptr) before doing a full search.
+   */
+  virtual const Elem * locate_with_hint (const Point & p,
+                                         const Elem * hint,
+                                         const std::set<subdomain_id_type> * allowed_subdomains) const;
+
   /**
    * Const pointer to our master, initialized to \p nullptr if none
    * given.  When using multiple PointLocators, one can be assigned
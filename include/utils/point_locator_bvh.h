@@ -0,0 +1,215 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_LOCATOR_BVH_H
+#define LIBMESH_POINT_LOCATOR_BVH_H
+
+// libmesh includes
+#include "libmesh/point_locator_base.h"
+#include "libmesh/point.h"
+#include "libmesh/tensor_value.h"
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+class Elem;
+
+/**
+ * This is a PointLocator that uses a bounding volume hierarchy (BVH)
+ * of the loose bounding boxes of the active elements.  Unlike the
+ * octree used by PointLocatorTree, the BVH is split at the median of
+ * the element vertex averages along the longest axis of each node,
+ * so it stays balanced on strongly anisotropic or graded meshes
+ * where an octree degenerates into long chains of one-element
+ * leaves.
+ *
+ * Each interior node stores the boxes of both of its children side
+ * by side, so a traversal step tests the query point against both
+ * boxes with one branch-free loop.  Elements with an affine map and
+ * full spatial dimension get their inverse map precomputed, so the
+ * containment test for them is a matrix-vector product instead of a
+ * Newton iteration.
+ *
+ * The hierarchy is built once by the master locator and shared with
+ * any servants; searches do not modify the locator, so they may be
+ * run concurrently.
+ */
+class PointLocatorBVH : public PointLocatorBase
+{
+public:
+  /**
+   * Constructor.  Needs the \p mesh in which the points should be
+   * located.  Optionally takes a pointer to a "master" PointLocator
+   * object, whose hierarchy is then shared rather than rebuilt.
+   */
+  PointLocatorBVH (const MeshBase & mesh,
+                   const PointLocatorBase * master = nullptr);
+
+  /**
+   * Destructor.
+   */
+  virtual ~PointLocatorBVH ();
+
+  /**
+   * Restore to PointLocator to a just-constructed state.
+   */
+  virtual void clear() override final;
+
+  /**
+   * Initializes the locator, so that the \p operator() methods can
+   * be used.
+   */
+  virtual void init() override final;
+
+  /**
+   * Locates the element in which the point with global coordinates \p
+   * p is located, optionally restricted to a set of allowed
+   * subdomains.
+   */
+  virtual const Elem * operator() (const Point & p,
+                                   const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override final;
+
+  /**
+   * Locates a set of elements in proximity to the point with global
+   * coordinates \p p.  Optionally allows the user to restrict the
+   * subdomains searched.
+   */
+  virtual void operator() (const Point & p,
+                           std::set<const Elem *> & candidate_elements,
+                           const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override final;
+
+  /**
+   * Enables out-of-mesh mode.  In this mode, if a searched-for Point
+   * is not contained in any element of the Mesh, return nullptr
+   * instead of throwing an error.  By default, this mode is off.
+   */
+  virtual void enable_out_of_mesh_mode () override final;
+
+  /**
+   * Disables out-of-mesh mode (default).  See above.
+   */
+  virtual void disable_out_of_mesh_mode () override final;
+
+protected:
+
+  /**
+   * \returns A locator sharing our hierarchy, with our tolerances and
+   * out-of-mesh mode.
+   */
+  virtual std::unique_ptr<PointLocatorBase> build_servant () const override;
+
+private:
+
+  /**
+   * An element in the hierarchy: its loose bounding box, the
+   * element's hmax() for scaling the box tolerance, and, if \p
+   * affine is true, the data of its inverse map xi = inv_jac*(p - origin).
+   */
+  struct Entry
+  {
+    const Elem * elem;
+    Real lo[LIBMESH_DIM];
+    Real hi[LIBMESH_DIM];
+    Real h;
+    bool affine;
+    Point origin;
+    RealTensorValue inv_jac;
+  };
+
+  /**
+   * A reference to a child of an interior node.  If \p count is zero
+   * then \p first is the index of an interior node, otherwise the
+   * child is a leaf holding the \p count entries starting at \p first.
+   */
+  struct ChildRef
+  {
+    unsigned int first;
+    unsigned int count;
+  };
+
+  /**
+   * An interior node, holding the boxes of both of its children, and
+   * the largest element hmax() beneath each of them.
+   */
+  struct Node
+  {
+    Real lo[2][LIBMESH_DIM];
+    Real hi[2][LIBMESH_DIM];
+    Real h[2];
+    ChildRef child[2];
+  };
+
+  /**
+   * The shared hierarchy: the entries in leaf order, the interior
+   * nodes, and a reference to the root.
+   */
+  struct Hierarchy
+  {
+    std::vector<Entry> entries;
+    std::vector<Node> nodes;
+    ChildRef root;
+  };
+
+  /**
+   * Builds the subtree for entries [begin, end), appending interior
+   * nodes to \p h, and returns a reference to it.  Sets \p lo, \p hi
+   * and \p hmax to the bounds of the subtree.
+   */
+  static ChildRef build_subtree (Hierarchy & h,
+                                 std::vector<Point> & averages,
+                                 unsigned int begin,
+                                 unsigned int end,
+                                 Real * lo,
+                                 Real * hi,
+                                 Real & hmax);
+
+  /**
+   * Calls \p f on each entry whose tolerance-inflated box contains \p
+   * p, in a deterministic order, until \p f returns true.
+   */
+  template <typename Functor>
+  void for_each_candidate (const Point & p, Real tol, Functor f) const;
+
+  /**
+   * \returns true if the element of \p entry contains \p p to within
+   * \p tol, using the precomputed inverse map when available and
+   * otherwise the element's own test.
+   */
+  bool entry_contains (const Entry & entry, const Point & p, Real tol) const;
+
+  /**
+   * The hierarchy, shared between a master and its servants.
+   */
+  std::shared_ptr<const Hierarchy> _hierarchy;
+
+  /**
+   * \p true if out-of-mesh mode is enabled.
+   */
+  bool _out_of_mesh_mode;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_LOCATOR_BVH_H
@@ -197,6 +197,12 @@ public:
 
 protected:
 
+  /**
+   * \returns A locator sharing our kd-tree, with our tolerances,
+   * number of results and out-of-mesh mode.
+   */
+  virtual std::unique_ptr<PointLocatorBase> build_servant () const override;
+
   /**
    * \p true if out-of-mesh mode is enabled.  See \p
    * enable_out_of_mesh_mode() for details.
@@ -108,6 +108,22 @@ public:
   virtual const Elem * operator() (const Point & p,
                                    const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override final;
 
+  /**
+   * Locates the element containing \p p as operator() does, but
+   * checks the caller's \p hint (which may be nullptr) first instead
+   * of the element found by the previous operator() call, and changes
+   * nothing in the locator.  Several threads may therefore query one
+   * locator at once, each keeping its own hint, rather than each
+   * building its own sub-locator.
+   *
+   * Unlike operator(), this doesn't log its own performance data,
+   * although a linear search with a close-to-point tolerance still
+   * does.
+   */
+  const Elem * locate (const Point & p,
+                       const Elem * hint,
+                       const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const;
+
   /**
    * Locates a set of elements in proximity to the point with global coordinates
    * \p p  Pure virtual. Optionally allows the user to restrict the subdomains searched.
@@ -164,6 +180,19 @@ public:
   unsigned int get_target_bin_size() const;
 
 protected:
+  /**
+   * \returns A locator sharing our tree, with our build type,
+   * tolerances and out-of-mesh mode.
+   */
+  virtual std::unique_ptr<PointLocatorBase> build_servant () const override;
+
+  /**
+   * Uses locate(), so the element we found last is left alone.
+   */
+  virtual const Elem * locate_with_hint (const Point & p,
+                                         const Elem * hint,
+                                         const std::set<subdomain_id_type> * allowed_subdomains) const override;
+
   /**
    * Pointer to our tree.  The tree is built at run-time
    * through \p init().  For non-master PointLocators,
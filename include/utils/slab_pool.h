@@ -0,0 +1,68 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SLAB_POOL_H
+#define LIBMESH_SLAB_POOL_H
+
+// C++ includes
+#include <cstddef>
+
+namespace libMesh
+{
+
+/**
+ * Process-wide slab allocation for small, numerous objects such as
+ * the \p Node and \p Elem objects of a mesh.  Blocks of each size
+ * class are carved out of large slabs and recycled through per-thread
+ * free lists, so building a mesh makes a few large allocations rather
+ * than one per object, objects built together tend to sit together in
+ * memory, and freeing them doesn't fragment the heap.  Slabs are kept
+ * for reuse until the process exits.
+ *
+ * Pooling is enabled by the "--pool-mesh-objects" command line
+ * option.  The choice is made at the first allocation, which must
+ * come after libMesh is initialized for the option to be seen, and
+ * does not change afterwards.  When pooling is disabled, and for
+ * blocks too large to pool, allocation falls through to the global
+ * operator new and delete.
+ */
+namespace SlabPool
+{
+
+/**
+ * \returns \p true if allocations are taken from slabs.
+ */
+bool enabled ();
+
+/**
+ * \returns A block of at least \p size bytes, aligned for any
+ * fundamental type.
+ */
+void * allocate (std::size_t size);
+
+/**
+ * Releases a block obtained from \p allocate() with the same \p size.
+ */
+void deallocate (void * p, std::size_t size) noexcept;
+
+} // namespace SlabPool
+
+} // namespace libMesh
+
+#endif // LIBMESH_SLAB_POOL_H
@@ -0,0 +1,295 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SMALL_VECTOR_H
+#define LIBMESH_SMALL_VECTOR_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace libMesh
+{
+
+/**
+ * The \p small_vector templated class provides the subset of the
+ * std::vector interface used by \p DofObject index buffers, storing
+ * up to \p N entries inline rather than on the heap.  Containers of
+ * a few entries, held by very many objects, then need no allocation
+ * of their own, and their entries sit next to the rest of the
+ * object in memory.  Larger containers spill onto the heap as a
+ * std::vector would.
+ *
+ * The size and capacity share the space of a single pointer on
+ * common platforms, so for small \p N this costs little more than
+ * the std::vector header it replaces.
+ *
+ * Only trivially copyable entry types are supported, and sizes are
+ * limited to what a 32 bit unsigned integer can count.
+ */
+template <typename T, unsigned int N>
+class small_vector
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "small_vector only holds trivially copyable types");
+  static_assert(N > 0, "small_vector needs inline storage");
+
+public:
+  typedef T              value_type;
+  typedef T *            iterator;
+  typedef const T *      const_iterator;
+  typedef std::uint32_t  size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  small_vector () :
+    _size(0),
+    _capacity(N)
+  {}
+
+  small_vector (std::size_t n, const T & value = T()) :
+    _size(0),
+    _capacity(N)
+  { this->resize(n, value); }
+
+  small_vector (const small_vector & other) :
+    _size(0),
+    _capacity(N)
+  { this->assign(other.begin(), other.end()); }
+
+  small_vector (small_vector && other) noexcept :
+    _size(0),
+    _capacity(N)
+  { this->steal(other); }
+
+  template <typename InputIterator,
+            typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+  small_vector (InputIterator first, InputIterator last) :
+    _size(0),
+    _capacity(N)
+  { this->assign(first, last); }
+
+  ~small_vector ()
+  { this->release(); }
+
+  small_vector & operator= (const small_vector & other)
+  {
+    if (this != &other)
+      this->assign(other.begin(), other.end());
+    return *this;
+  }
+
+  small_vector & operator= (small_vector && other) noexcept
+  {
+    if (this != &other)
+      {
+        this->release();
+        this->steal(other);
+      }
+    return *this;
+  }
+
+  /**
+   * Replaces our entries with those in [\p first, \p last).
+   */
+  template <typename InputIterator>
+  void assign (InputIterator first, InputIterator last)
+  {
+    const std::size_t n = std::distance(first, last);
+    _size = 0;
+    this->reserve(n);
+    std::copy(first, last, this->data());
+    _size = cast_int<size_type>(n);
+  }
+
+  std::size_t size () const { return _size; }
+  bool empty () const { return !_size; }
+  std::size_t capacity () const { return _capacity; }
+
+  /**
+   * \returns \p true if our entries are stored inline.
+   */
+  bool is_inline () const { return _capacity == N; }
+
+  T * data () { return this->is_inline() ? _storage.local : _storage.heap; }
+  const T * data () const { return this->is_inline() ? _storage.local : _storage.heap; }
+
+  iterator begin () { return this->data(); }
+  iterator end () { return this->data() + _size; }
+  const_iterator begin () const { return this->data(); }
+  const_iterator end () const { return this->data() + _size; }
+
+  T & operator[] (std::size_t i)
+  {
+    libmesh_assert_less (i, _size);
+    return this->data()[i];
+  }
+
+  const T & operator[] (std::size_t i) const
+  {
+    libmesh_assert_less (i, _size);
+    return this->data()[i];
+  }
+
+  T & back () { return (*this)[_size-1]; }
+  const T & back () const { return (*this)[_size-1]; }
+
+  void clear () { _size = 0; }
+
+  /**
+   * Makes room for at least \p n entries.
+   */
+  void reserve (std::size_t n)
+  {
+    if (n <= _capacity)
+      return;
+
+    libmesh_assert_less_equal (n, std::size_t(UINT32_MAX));
+
+    T * new_data = new T[n];
+    std::copy(this->begin(), this->end(), new_data);
+    this->release();
+    _storage.heap = new_data;
+    _capacity = cast_int<size_type>(n);
+  }
+
+  void resize (std::size_t n, const T & value = T())
+  {
+    if (n > _size)
+      {
+        // value may be one of our own entries
+        const T v = value;
+        this->grow(n);
+        std::fill(this->data() + _size, this->data() + n, v);
+      }
+    _size = cast_int<size_type>(n);
+  }
+
+  void push_back (const T & value)
+  {
+    const T v = value;
+    this->grow(_size + 1);
+    this->data()[_size++] = v;
+  }
+
+  iterator insert (const_iterator pos, const T & value)
+  {
+    const T v = value;
+    const std::size_t offset = pos - this->begin();
+    this->grow(_size + 1);
+    T * p = this->data() + offset;
+    std::copy_backward(p, this->end(), this->end() + 1);
+    *p = v;
+    ++_size;
+    return p;
+  }
+
+  template <typename InputIterator,
+            typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+  iterator insert (const_iterator pos, InputIterator first, InputIterator last)
+  {
+    // Copy first, in case the range is ours
+    const small_vector values(first, last);
+    const std::size_t offset = pos - this->begin();
+    const std::size_t n = values.size();
+    this->grow(_size + n);
+    T * p = this->data() + offset;
+    std::copy_backward(p, this->end(), this->end() + n);
+    std::copy(values.begin(), values.end(), p);
+    _size += cast_int<size_type>(n);
+    return p;
+  }
+
+  iterator erase (const_iterator first, const_iterator last)
+  {
+    T * p = this->data() + (first - this->begin());
+    const std::size_t n = last - first;
+    std::copy(p + n, this->end(), p);
+    _size -= cast_int<size_type>(n);
+    return p;
+  }
+
+  void swap (small_vector & other) noexcept
+  {
+    small_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  /**
+   * Moves our entries back inline if they fit there, or otherwise
+   * onto a heap allocation of exactly their size.
+   */
+  void shrink_to_fit ()
+  {
+    if (_capacity != std::max(std::size_t(N), std::size_t(_size)))
+      small_vector(*this).swap(*this);
+  }
+
+private:
+
+  /**
+   * Makes room for at least \p n entries, growing geometrically.
+   */
+  void grow (std::size_t n)
+  {
+    if (n > _capacity)
+      this->reserve(std::max(n, 2*std::size_t(_capacity)));
+  }
+
+  void release () noexcept
+  {
+    if (!this->is_inline())
+      delete [] _storage.heap;
+    _capacity = N;
+  }
+
+  // Takes other's entries, leaving it empty; requires us to be
+  // released already
+  void steal (small_vector & other) noexcept
+  {
+    if (other.is_inline())
+      std::memcpy(_storage.local, other._storage.local, other._size * sizeof(T));
+    else
+      _storage.heap = other._storage.heap;
+
+    _size = other._size;
+    _capacity = other._capacity;
+    other._size = 0;
+    other._capacity = N;
+  }
+
+  size_type _size;
+  size_type _capacity;
+
+  union Storage
+  {
+    T local[N];
+    T * heap;
+  } _storage;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SMALL_VECTOR_H
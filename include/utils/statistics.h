@@ -111,8 +111,9 @@ public:
   /**
    * \returns The median (e.g. the middle) value of the data set.
    *
-   * This function modifies the original data by sorting, so it can't
-   * be called on const objects.  Source: GNU Scientific Library.
+   * This function modifies the original data by partially sorting
+   * it, so it can't be called on const objects.  Source: GNU
+   * Scientific Library.
    */
   virtual Real median();
 
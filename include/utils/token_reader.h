@@ -0,0 +1,184 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2023 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_TOKEN_READER_H
+#define LIBMESH_TOKEN_READER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <charconv>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <system_error> // std::errc
+
+namespace libMesh
+{
+
+/**
+ * Reads separated tokens from an ASCII stream a line at a time,
+ * parsing numbers in place.  This is much faster than extracting
+ * each value from the stream with operator>> or from a
+ * std::stringstream built for every line, which matters for the
+ * node and element sections of large mesh files.
+ *
+ * Whitespace always separates tokens; further separator characters,
+ * such as the commas of Abaqus files, may be given to the
+ * constructor.  Only whole lines are consumed from the stream, so
+ * the stream can be read directly again once the last token on a
+ * line has been read, or after \p skip_line().
+ *
+ * Integers are parsed with std::from_chars.  Reals are parsed with
+ * strtod (or strtold), optionally accepting Fortran-style "D"
+ * exponents.
+ */
+class TokenReader
+{
+public:
+  /**
+   * Reads tokens from \p in, split at whitespace and at any of the
+   * \p separators.
+   */
+  explicit TokenReader (std::istream & in,
+                        std::string_view separators = "");
+
+  /**
+   * Sets whether reals may use "D" or "d" in place of "E" for the
+   * exponent, as in UNV files.  Defaults to \p false.
+   */
+  void set_fortran_exponents (bool fortran_exponents)
+  { _fortran_exponents = fortran_exponents; }
+
+  /**
+   * \returns The next token, reading further lines as necessary.
+   * The view is valid until the next line is read.
+   */
+  std::string_view read_token ();
+
+  /**
+   * \returns The next token parsed as an integer of type \p T.
+   */
+  template <typename T>
+  T read_int ();
+
+  /**
+   * \returns The next token parsed as a Real.
+   */
+  Real read_real ();
+
+  /**
+   * Reads the next line of the stream, discarding anything left on
+   * the current one.
+   *
+   * \returns \p false at the end of the stream.
+   */
+  bool read_line ();
+
+  /**
+   * Discards anything left on the current line, so the next token
+   * comes from the next line.
+   */
+  void skip_line ();
+
+  /**
+   * \returns \p true if no token is left on the current line.
+   */
+  bool at_line_end ();
+
+  /**
+   * \returns The next token on the current line, or an empty view if
+   * there is none left.  No further lines are read.
+   */
+  std::string_view next_field ();
+
+  /**
+   * Parses all of \p field, which should come from \p next_field()
+   * or \p read_token(), as an integer.
+   *
+   * \returns \p false if \p field is not an integer of type \p T.
+   */
+  template <typename T>
+  static bool parse_int (std::string_view field, T & value);
+
+  /**
+   * Parses all of \p field as a Real.
+   *
+   * \returns \p false if \p field is not a number.
+   */
+  bool parse_real (std::string_view field, Real & value) const;
+
+  /**
+   * \returns The current line, for error messages.
+   */
+  const std::string & line () const { return _line; }
+
+private:
+  /**
+   * \returns \p true if \p c separates tokens.
+   */
+  bool is_separator (char c) const;
+
+  /**
+   * Moves _pos past any separators on the current line.
+   */
+  void skip_separators ();
+
+  std::istream & _in;
+  const std::string _separators;
+  std::string _line;
+  std::size_t _pos;
+  bool _fortran_exponents;
+};
+
+
+
+// ------------------------------------------------------------
+// TokenReader inline methods
+template <typename T>
+inline
+bool TokenReader::parse_int (std::string_view field, T & value)
+{
+  const char * end = field.data() + field.size();
+  // std::from_chars doesn't accept a leading '+'
+  const char * begin = (!field.empty() && field[0] == '+') ?
+    field.data() + 1 : field.data();
+  const auto result = std::from_chars(begin, end, value);
+  return result.ec == std::errc() && result.ptr == end && begin != end;
+}
+
+
+
+template <typename T>
+inline
+T TokenReader::read_int ()
+{
+  const std::string_view token = this->read_token();
+
+  T value = 0;
+  libmesh_error_msg_if(!parse_int(token, value),
+                       "Error reading an integer from line: " << _line);
+  return value;
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_TOKEN_READER_H
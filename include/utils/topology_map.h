@@ -24,9 +24,12 @@
 #include "libmesh/libmesh_config.h"
 #include "libmesh/libmesh_common.h"
 #include "libmesh/hashing.h"
+#include "libmesh/threads.h"
 
 // C++ Includes
+#include <array>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace libMesh
@@ -50,6 +53,12 @@ class Node;
  * For efficiency we will use a hashed map if it is available,
  * otherwise a regular map.
  *
+ * The map is split into shards, each with its own lock, so \p
+ * add_node(), \p add_nodes() and \p find() may be called
+ * concurrently from multiple threads, e.g. while refining or
+ * modifying a mesh in a threaded loop.  Threads which insert the
+ * same key must insert the same node for it.
+ *
  * \author Roy Stogner
  * \date 2015
  * \brief Enables topology-based lookups of nodes.
@@ -59,9 +68,11 @@ class TopologyMap
   // We need to supply our own hash function.
   typedef std::unordered_map<std::pair<dof_id_type, dof_id_type>, dof_id_type, libMesh::hash> map_type;
 public:
+  typedef std::vector<std::pair<dof_id_type, dof_id_type>> bracket_type;
+
   void init(MeshBase &);
 
-  void clear() { _map.clear(); }
+  void clear();
 
   /**
    * Add a node to the map, between each pair of specified bracketing
@@ -72,7 +83,22 @@ public:
                 std::pair<dof_id_type, dof_id_type>> &
                 bracketing_nodes);
 
-  bool empty() const { return _map.empty(); }
+  /**
+   * Adds many nodes at once, each between its pairs of bracketing
+   * nodes.  Each shard of the map is only locked once, so this is
+   * cheaper than separate \p add_node() calls when other threads are
+   * inserting too.
+   */
+  void add_nodes(const std::vector<std::pair<const Node *, bracket_type>> & nodes);
+
+  /**
+   * Moves every entry of \p other into this map, leaving \p other
+   * empty.  This allows threads to fill private maps without any
+   * locking and combine them afterwards.
+   */
+  void merge(TopologyMap & other);
+
+  bool empty() const;
 
   dof_id_type find(dof_id_type bracket_node1,
                    dof_id_type bracket_node2) const;
@@ -85,7 +111,32 @@ protected:
   void fill(const MeshBase &);
 
 private:
-  map_type          _map;
+  /**
+   * The number of independently locked pieces of the map.
+   */
+  static constexpr unsigned int n_shards = 64;
+
+  struct Shard
+  {
+    map_type map;
+    mutable Threads::spin_mutex mutex;
+  };
+
+  /**
+   * \returns The shard holding the key \p lower_id, \p upper_id.
+   */
+  static unsigned int shard_of(dof_id_type lower_id,
+                               dof_id_type upper_id);
+
+  /**
+   * Inserts one sorted key into \p shard, whose lock the caller
+   * holds.
+   */
+  static void insert(Shard & shard,
+                     const std::pair<dof_id_type, dof_id_type> & key,
+                     dof_id_type mid_node_id);
+
+  std::array<Shard, n_shards> _shards;
 };
 
 } // namespace libMesh
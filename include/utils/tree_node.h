@@ -101,6 +101,18 @@ public:
    */
   bool insert (const Elem * nd);
 
+  /**
+   * Inserts each of \p nds, in order, with the same result as
+   * inserting them one at a time.  Once this node has refined, its
+   * children's subtrees are independent of one another, so they
+   * receive the remaining objects on separate threads.
+   *
+   * \returns \p true iff every object is inserted into the TreeNode
+   * or one of its children.
+   */
+  bool insert (const std::vector<const Node *> & nds);
+  bool insert (const std::vector<const Elem *> & elems);
+
   /**
    * Refine the tree node into N children if it contains
    * more than tol nodes.
@@ -179,6 +191,12 @@ public:
                       Real relative_tol = TOLERANCE) const;
 
 private:
+  /**
+   * Implementation of the vector insert() overloads.
+   */
+  template <typename T>
+  bool insert_all (const std::vector<const T *> & objects);
+
   /**
    * Look for point \p p in our children,
    * optionally restricted to a set of allowed subdomains.
@@ -27,10 +27,16 @@
 #include <vector>
 #include <algorithm> // is_sorted, lower_bound
 #include <memory> // unique_ptr
+#include <utility> // pair
 
 namespace libMesh
 {
 
+// Forward declarations
+namespace Parallel {
+  class Communicator;
+}
+
 /**
  * Encapsulates the common "get value from map, otherwise error"
  * idiom, which is similar to calling map.at(), but gives a more
@@ -58,6 +64,27 @@ namespace Utility
  */
 std::string system_info();
 
+/**
+ * \returns A table of estimated memory use, with a row for each named
+ * byte count in \p bytes and a final total, giving the minimum and
+ * maximum per processor and the sum over the processors of \p comm.
+ * This must be called on every processor of \p comm, with the same
+ * names in the same order.
+ */
+std::string parallel_memory_table
+  (const Parallel::Communicator & comm,
+   const std::vector<std::pair<std::string, std::size_t>> & bytes);
+
+/**
+ * \returns A table with a row for each named value in \p values,
+ * giving its minimum, maximum and mean over the processors of
+ * \p comm.  This must be called on every processor of \p comm, with
+ * the same names in the same order.
+ */
+std::string parallel_statistics_table
+  (const Parallel::Communicator & comm,
+   const std::vector<std::pair<std::string, double>> & values);
+
 /**
  * Helper struct for enabling template metaprogramming/SFINAE.
  */
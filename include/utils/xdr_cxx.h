@@ -160,6 +160,29 @@ public:
   template <typename T>
   void data_stream (T * val, const unsigned int len, const unsigned int line_break=libMesh::invalid_uint);
 
+  /**
+   * Appends to \p bytes exactly the bytes which \p data_stream()
+   * would write for \p val in an \p ENCODE file.  This allows pieces
+   * of a binary file to be built up in memory, e.g. on each processor
+   * for a collective MPI-IO write.
+   */
+  template <typename T>
+  static void encode (const T * val, std::size_t len, std::vector<char> & bytes);
+
+  /**
+   * \returns The current byte offset in an \p ENCODE or \p DECODE
+   * file, after flushing any buffered output.
+   */
+  std::size_t position ();
+
+  /**
+   * Moves to byte offset \p pos in an \p ENCODE or \p DECODE file,
+   * after flushing any buffered output.  Seeking past the end of an
+   * \p ENCODE file leaves a gap which must be filled by some other
+   * writer.
+   */
+  void seek (std::size_t pos);
+
   /**
    * Writes or reads (ignores) a comment line.
    */
@@ -86,6 +86,7 @@ AS_ECHO(["  Dirichlet constraints............ : $enabledirichlet"])
 AS_ECHO(["  node constraints................. : $enablenodeconstraint"])
 AS_ECHO(["  parallel mesh.................... : $enableparmesh"])
 AS_ECHO(["  performance logging.............. : $enableperflog"])
+AS_ECHO(["  performance logging of MPI....... : $enableperflogmpi"])
 AS_ECHO(["  periodic boundary conditions..... : $enableperiodic"])
 AS_ECHO(["  real number type................. : $enablerealprecision"])
 AS_ECHO(["  reference counting............... : $enablerefct"])
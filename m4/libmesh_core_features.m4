@@ -669,6 +669,25 @@ AS_IF([test "$enableperflog" != no],
 
 
 
+# -------------------------------------------------------------
+# MPI traffic in performance logs -- disabled by default, since it
+# replaces MPI functions through the MPI profiling interface
+# -------------------------------------------------------------
+AC_ARG_ENABLE(perflog-mpi,
+              AS_HELP_STRING([--enable-perflog-mpi],
+                             [intercept MPI calls to log communication per performance log event]),
+              enableperflogmpi=$enableval,
+              enableperflogmpi=no)
+
+AS_IF([test "$enableperflogmpi" != no],
+      [
+        AC_DEFINE(ENABLE_PERFLOG_MPI, 1, [Flag indicating if the library should intercept MPI calls to log communication])
+        AC_MSG_RESULT(<<< Configuring library to log MPI traffic >>>)
+      ])
+# ------------------------------------------------------------
+
+
+
 # -------------------------------------------------------------
 # Examples - enabled by default
 # -------------------------------------------------------------
@@ -27,9 +27,10 @@ AC_DEFUN([ACX_BEST_THREAD],
   dnl machine with 4 physical cores will try and spawn up to 16
   dnl simultaneous threads in this configuration.
   dnl
-  dnl [0]: The "pthread" threading model (see below) can optionally use
-  dnl OpenMP pragmas for its parallel_for() and parallel_reduce()
-  dnl implementations.
+  dnl [0]: When OpenMP is found, the "pthread" threading model (see
+  dnl below) implements Threads::parallel_for(), parallel_reduce() and
+  dnl the Threads mutexes on top of the OpenMP runtime, sharing its
+  dnl thread pool rather than starting threads of its own.
   dnl
   dnl [1]: https://gcc.gnu.org/onlinedocs/libgomp/OMP_005fNUM_005fTHREADS.html
   AC_ARG_ENABLE(openmp,
@@ -8,6 +8,7 @@
 #include <libmesh/equation_systems.h>
 #include <libmesh/fe_base.h>
 #include <libmesh/fe_interface.h>
+#include <libmesh/fe_reference_shape_cache.h>
 #include <libmesh/function_base.h>
 #include <libmesh/mesh.h>
 #include <libmesh/mesh_generation.h>
@@ -28,7 +29,9 @@
   CPPUNIT_TEST( testHessU );                    \
   CPPUNIT_TEST( testHessUComp );                \
   CPPUNIT_TEST( testDualDoesntScreamAndDie );   \
-  CPPUNIT_TEST( testCustomReinit );
+  CPPUNIT_TEST( testCustomReinit );             \
+  CPPUNIT_TEST( testAllShapes );                \
+  CPPUNIT_TEST( testReferenceShapeCache );
 
 using namespace libMesh;
 
@@ -897,6 +900,85 @@ public:
     }
   }
 
+  void testAllShapes()
+  {
+    LOG_UNIT_TEST;
+
+    // Handle the "more processors than elements" case
+    if (!this->_elem)
+      return;
+
+    // XYZ shape functions are evaluated at physical points
+    if (family == XYZ)
+      return;
+
+    // The batched shape evaluation used by reinit() should agree
+    // with evaluating one shape function at one point at a time.
+    const std::vector<std::vector<Real>> * dphiref[3] =
+      { &this->_fe->get_dphidxi(),
+        &this->_fe->get_dphideta(),
+        &this->_fe->get_dphidzeta() };
+
+    const FEType fe_type = this->_sys->variable_type(0);
+    const std::vector<Point> & qp = this->_qrule->get_points();
+    const std::vector<std::vector<Real>> & phi = this->_fe->get_phi();
+
+    for (const auto & elem : this->_mesh->active_local_element_ptr_range())
+      {
+        this->_fe->reinit(elem);
+
+        for (auto i : index_range(phi))
+          for (auto q : index_range(qp))
+            {
+              LIBMESH_ASSERT_FP_EQUAL
+                (FEInterface::shape(fe_type, elem, i, qp[q]),
+                 phi[i][q], this->_value_tol);
+
+              for (unsigned int j = 0; j != this->_dim; ++j)
+                LIBMESH_ASSERT_FP_EQUAL
+                  (FEInterface::shape_deriv(fe_type, elem, i, j, qp[q]),
+                   (*dphiref[j])[i][q], this->_grad_tol);
+            }
+      }
+  }
+
+  void testReferenceShapeCache()
+  {
+    LOG_UNIT_TEST;
+
+    // Handle the "more processors than elements" case
+    if (!this->_elem)
+      return;
+
+    // Compute everything from scratch first
+    FEReferenceShapeCache<Real>::enable(false);
+    this->_fe->reinit(this->_elem);
+    const std::vector<std::vector<RealGradient>> dphi = this->_fe->get_dphi();
+    FEReferenceShapeCache<Real>::enable(true);
+
+    // Then make sure that FE objects which fill and then share the
+    // cache get the same answers
+    const FEType fe_type = this->_sys->variable_type(0);
+    for (unsigned int n = 0; n != 2; ++n)
+      {
+        std::unique_ptr<FEBase> fe (FEBase::build(this->_dim, fe_type));
+        QGauss qrule (this->_dim, fe_type.default_quadrature_order());
+        fe->attach_quadrature_rule(&qrule);
+        const std::vector<std::vector<RealGradient>> & fe_dphi = fe->get_dphi();
+        fe->reinit(this->_elem);
+
+        CPPUNIT_ASSERT_EQUAL(dphi.size(), fe_dphi.size());
+        for (auto i : index_range(dphi))
+          {
+            CPPUNIT_ASSERT_EQUAL(dphi[i].size(), fe_dphi[i].size());
+            for (auto q : index_range(dphi[i]))
+              for (unsigned int d = 0; d != LIBMESH_DIM; ++d)
+                LIBMESH_ASSERT_FP_EQUAL(dphi[i][q](d), fe_dphi[i][q](d),
+                                        this->_grad_tol);
+          }
+      }
+  }
+
 };
 
 
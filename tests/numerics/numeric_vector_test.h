@@ -5,10 +5,14 @@
 #include "test_comm.h"
 
 // libMesh includes
+#include <libmesh/compressed_vector.h>
+#include <libmesh/numeric_vector_const_view.h>
 #include <libmesh/parallel.h>
+#include <libmesh/reduced_precision_vector.h>
 
 #include "libmesh_cppunit.h"
 
+#include <cmath>
 #include <memory>
 
 #define NUMERICVECTORTEST                       \
@@ -21,7 +25,11 @@
   CPPUNIT_TEST( testNorms );                    \
   CPPUNIT_TEST( testNormsBase );                \
   CPPUNIT_TEST( testOperations );               \
-  CPPUNIT_TEST( testOperationsBase );
+  CPPUNIT_TEST( testOperationsBase );           \
+  CPPUNIT_TEST( testConstView );                \
+  CPPUNIT_TEST( testFusedOperations );          \
+  CPPUNIT_TEST( testReducedPrecision );
+  CPPUNIT_TEST( testCompressed );
 
 
 template <class DerivedClass>
@@ -294,6 +302,169 @@ public:
     }
   }
 
+  void testConstView()
+  {
+    LOG_UNIT_TEST;
+
+    auto v_ptr = std::make_unique<DerivedClass>(*my_comm, global_size, local_size);
+    libMesh::NumericVector<libMesh::Number> & v = *v_ptr;
+
+    const libMesh::dof_id_type
+      first = v.first_local_index(),
+      last  = v.last_local_index();
+
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      v.set (n, static_cast<libMesh::Number>(2*n+1));
+    v.close();
+
+    const libMesh::NumericVectorConstView<libMesh::Number> view(v);
+    CPPUNIT_ASSERT(view.size() >= last - first);
+
+    std::vector<libMesh::numeric_index_type> indices;
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      {
+        LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(2*n+1),
+                                libMesh::libmesh_real(view(n)),
+                                libMesh::TOLERANCE*libMesh::TOLERANCE);
+        indices.push_back(last-1-(n-first));
+      }
+
+    std::vector<libMesh::Number> values;
+    view.get(indices, values);
+    CPPUNIT_ASSERT_EQUAL(indices.size(), values.size());
+    for (auto i : libMesh::index_range(indices))
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(2*indices[i]+1),
+                              libMesh::libmesh_real(values[i]),
+                              libMesh::TOLERANCE*libMesh::TOLERANCE);
+  }
+
+  void testFusedOperations()
+  {
+    LOG_UNIT_TEST;
+
+    auto u_ptr = std::make_unique<DerivedClass>(*my_comm, global_size, local_size);
+    auto x_ptr = std::make_unique<DerivedClass>(*my_comm, global_size, local_size);
+    auto y_ptr = std::make_unique<DerivedClass>(*my_comm, global_size, local_size);
+    libMesh::NumericVector<libMesh::Number> & u = *u_ptr;
+    libMesh::NumericVector<libMesh::Number> & x = *x_ptr;
+    libMesh::NumericVector<libMesh::Number> & y = *y_ptr;
+
+    const libMesh::dof_id_type
+      first = u.first_local_index(),
+      last  = u.last_local_index();
+
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      {
+        u.set (n, static_cast<libMesh::Number>(n+1));
+        x.set (n, static_cast<libMesh::Number>(2));
+        y.set (n, static_cast<libMesh::Number>(n));
+      }
+    u.close();
+    x.close();
+    y.close();
+
+    // u = 2*x + 3*y - u = 2n+3
+    u.axpbypcz(2, x, 3, y, -1);
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(2*n+3),
+                              libMesh::libmesh_real(u(n)),
+                              libMesh::TOLERANCE*libMesh::TOLERANCE);
+
+    // u += x - 2*u, aliasing u itself; gives -2n-1
+    u.maxpy({1, -2}, {&x, &u});
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      LIBMESH_ASSERT_FP_EQUAL(-libMesh::libmesh_real(2*n+1),
+                              libMesh::libmesh_real(u(n)),
+                              libMesh::TOLERANCE*libMesh::TOLERANCE);
+
+    std::vector<libMesh::Number> dots;
+    u.mdot({&x, &y, &u}, dots);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), dots.size());
+
+    const libMesh::Real scale = libMesh::Real(global_size) * global_size * global_size;
+    LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(u.dot(x)),
+                            libMesh::libmesh_real(dots[0]),
+                            scale*libMesh::TOLERANCE*libMesh::TOLERANCE);
+    LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(u.dot(y)),
+                            libMesh::libmesh_real(dots[1]),
+                            scale*libMesh::TOLERANCE*libMesh::TOLERANCE);
+    const libMesh::Real norm = u.l2_norm();
+    LIBMESH_ASSERT_FP_EQUAL(norm*norm,
+                            libMesh::libmesh_real(dots[2]),
+                            scale*libMesh::TOLERANCE*libMesh::TOLERANCE);
+  }
+
+  void testReducedPrecision()
+  {
+    LOG_UNIT_TEST;
+
+    auto v_ptr = std::make_unique<DerivedClass>(*my_comm, global_size, local_size);
+    libMesh::NumericVector<libMesh::Number> & v = *v_ptr;
+
+    const libMesh::dof_id_type
+      first = v.first_local_index(),
+      last  = v.last_local_index();
+
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      v.set (n, static_cast<libMesh::Number>(n + libMesh::Real(1)/3));
+    v.close();
+
+    const libMesh::ReducedPrecisionVector<libMesh::Number> stored(v);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(last - first), stored.size());
+
+    v.zero();
+    stored.restore(v);
+
+    // Single precision keeps about seven significant digits
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(n + libMesh::Real(1)/3),
+                              libMesh::libmesh_real(v(n)),
+                              (n+1) * libMesh::Real(1e-6));
+  }
+
+  void testCompressed()
+  {
+    LOG_UNIT_TEST;
+
+    auto v_ptr = std::make_unique<DerivedClass>(*my_comm, global_size, local_size);
+    libMesh::NumericVector<libMesh::Number> & v = *v_ptr;
+
+    const libMesh::dof_id_type
+      first = v.first_local_index(),
+      last  = v.last_local_index();
+
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      v.set (n, static_cast<libMesh::Number>(std::sin(n + libMesh::Real(1)/3)));
+    v.close();
+
+    // Lossless compression gives back exactly what went in
+    libMesh::CompressedVector<libMesh::Number> stored(v);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(last - first), stored.size());
+    CPPUNIT_ASSERT(!stored.lossy());
+
+    v.zero();
+    stored.restore(v);
+
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      CPPUNIT_ASSERT(v(n) == static_cast<libMesh::Number>(std::sin(n + libMesh::Real(1)/3)));
+
+    // Lossy compression stays within its tolerance
+    const libMesh::Real tol = 1e-4;
+    stored.store(v, tol);
+    CPPUNIT_ASSERT(stored.lossy());
+    if (stored.size())
+      CPPUNIT_ASSERT(stored.compressed_size() <
+                     stored.size() * sizeof(libMesh::Number));
+
+    v.zero();
+    stored.restore(v);
+
+    for (libMesh::dof_id_type n=first; n != last; n++)
+      LIBMESH_ASSERT_FP_EQUAL(std::sin(n + libMesh::Real(1)/3),
+                              libMesh::libmesh_real(v(n)),
+                              tol * (1 + libMesh::TOLERANCE));
+  }
+
   void testLocalize()
   {
     LOG_UNIT_TEST;